@@ -0,0 +1,52 @@
+#pragma once
+
+#include "core/Stopwatch.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+
+namespace Bench
+{
+
+    /// Command-line knobs shared by every benchmark (see BenchMain.cpp).
+    struct Options
+    {
+        double scale = 1.0; ///< multiplies the default problem sizes
+        int runs = 5;       ///< timed repetitions; the best one is reported
+    };
+
+    /// Problem size scaled by --scale (never below 1).
+    inline std::size_t scaled(const Options &opt, std::size_t n)
+    {
+        return std::max<std::size_t>(1, static_cast<std::size_t>(double(n) * opt.scale));
+    }
+
+    /// Best wall time of @p runs calls to fn() in milliseconds (after one untimed warm-up call).
+    template <typename Fn>
+    double bestOfMs(int runs, Fn &&fn)
+    {
+        fn();
+        double best = std::numeric_limits<double>::max();
+        for (int r = 0; r < runs; ++r)
+        {
+            Core::Stopwatch sw;
+            fn();
+            best = std::min(best, sw.elapsedMs());
+        }
+        return best;
+    }
+
+    /// One result row: "  <label>  <ms> ms  <x> x" relative to @p baselineMs.
+    inline void report(const char *label, double ms, double baselineMs)
+    {
+        std::printf("  %-34s %9.3f ms  %6.2fx\n", label, ms, baselineMs / ms);
+    }
+
+    // Benchmarks (one per file)
+    void runIndexWidening(const Options &opt);
+    void runMeshAttributes(const Options &opt);
+    void runFrustumCull(const Options &opt);
+
+} // namespace Bench
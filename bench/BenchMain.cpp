@@ -0,0 +1,73 @@
+#include "Bench.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Entry
+    {
+        const char *name;
+        const char *what;
+        void (*run)(const Bench::Options &);
+    };
+
+    const Entry kBenchmarks[] = {
+        {"indices", "glTF index widening / float copy vs. cgltf per-element reads", Bench::runIndexWidening},
+        {"attributes", "normal / tangent generation vs. the old serial generator", Bench::runMeshAttributes},
+        {"cull", "frustum culling of 100k boxes: cullAABBs vs. a scalar plane loop", Bench::runFrustumCull},
+    };
+
+    void usage()
+    {
+        std::printf("usage: OhhMyyBench [--scale S] [--runs N] [name ...]\n\nbenchmarks (default: all):\n");
+        for (const Entry &e : kBenchmarks)
+            std::printf("  %-12s %s\n", e.name, e.what);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Bench::Options opt;
+    std::vector<std::string> names;
+
+    // 1) Arguments
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--scale" && i + 1 < argc)
+            opt.scale = std::atof(argv[++i]);
+        else if (arg == "--runs" && i + 1 < argc)
+            opt.runs = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--help" || arg == "-h")
+        {
+            usage();
+            return EXIT_SUCCESS;
+        }
+        else
+            names.push_back(arg);
+    }
+
+    // 2) Selected benchmarks in table order
+    int ran = 0;
+    for (const Entry &e : kBenchmarks)
+    {
+        if (!names.empty() && std::find(names.begin(), names.end(), e.name) == names.end())
+            continue;
+        std::printf("== %s: %s\n", e.name, e.what);
+        e.run(opt);
+        std::printf("\n");
+        ++ran;
+    }
+
+    if (ran == 0)
+    {
+        usage();
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,5 @@
+// cgltf implementation for the benchmark executable (the engine gets it from libs/libs.cpp,
+// which also pulls in VMA and therefore Vulkan).
+#define _CRT_SECURE_NO_WARNINGS
+#define CGLTF_IMPLEMENTATION
+#include <cgltf.h>
@@ -0,0 +1,97 @@
+#include "Bench.h"
+
+#include "core/math/MathUtils.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace Bench
+{
+    namespace
+    {
+        using Core::MathUtils::AABB;
+        using Core::MathUtils::AABBSoA;
+        using Core::MathUtils::Frustum;
+
+        /// The per-item plane loop cullAABBs replaced (AoS boxes, early exit on the first
+        /// rejecting plane), kept as the baseline. Same conservative test, same output order.
+        std::size_t referenceCull(const Frustum &frustum, const std::vector<AABB> &boxes, uint32_t *outIndices)
+        {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < boxes.size(); ++i)
+            {
+                const glm::vec3 c = 0.5f * (boxes[i].min + boxes[i].max);
+                const glm::vec3 e = 0.5f * (boxes[i].max - boxes[i].min);
+
+                bool outside = false;
+                for (const glm::vec4 &p : frustum.planes)
+                {
+                    const glm::vec3 n(p);
+                    if (glm::dot(n, c) + p.w + glm::dot(glm::abs(n), e) < 0.0f)
+                    {
+                        outside = true;
+                        break;
+                    }
+                }
+                if (!outside)
+                    outIndices[count++] = uint32_t(i);
+            }
+            return count;
+        }
+    } // namespace
+
+    void runFrustumCull(const Options &opt)
+    {
+        // 1) Random boxes around a camera at the origin looking down -Z (about a quarter visible)
+        const std::size_t n = scaled(opt, 100'000);
+        std::mt19937 rng(21);
+        std::uniform_real_distribution<float> pos(-200.0f, 200.0f);
+        std::uniform_real_distribution<float> half(0.25f, 2.0f);
+
+        std::vector<AABB> aos(n);
+        AABBSoA soa;
+        soa.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const glm::vec3 c(pos(rng), pos(rng), pos(rng));
+            const glm::vec3 e(half(rng), half(rng), half(rng));
+            aos[i] = {c - e, c + e};
+            soa.set(i, aos[i]);
+        }
+
+        const glm::mat4 proj = glm::perspective(glm::radians(90.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const Frustum frustum = Core::MathUtils::extractFrustum(proj * view);
+
+        // 2) Both passes must keep the same boxes in the same order
+        std::vector<uint32_t> ref(n), simd(n);
+        const std::size_t refCount = referenceCull(frustum, aos, ref.data());
+        const std::size_t simdCount = Core::MathUtils::cullAABBs(frustum, soa, simd.data());
+        const bool same = refCount == simdCount && std::equal(ref.begin(), ref.begin() + refCount, simd.begin());
+        std::printf(" %zu boxes, %zu visible, index lists %s\n", n, simdCount, same ? "identical" : "DIFFER");
+
+        // 3) Timings (one culling pass each)
+        std::size_t sink = 0;
+        const double refMs = bestOfMs(opt.runs, [&]
+                                      { sink += referenceCull(frustum, aos, ref.data()); });
+        const double simdMs = bestOfMs(opt.runs, [&]
+                                       { sink += Core::MathUtils::cullAABBs(frustum, soa, simd.data()); });
+
+        report("scalar plane loop (AoS)", refMs, refMs);
+#if defined(__AVX2__)
+        report("cullAABBs (AVX2, SoA)", simdMs, refMs);
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        report("cullAABBs (SSE2, SoA)", simdMs, refMs);
+#else
+        report("cullAABBs (scalar, SoA)", simdMs, refMs);
+#endif
+        if (sink == 0)
+            std::printf("  (no visible boxes)\n");
+    }
+
+} // namespace Bench
@@ -0,0 +1,115 @@
+#include "Bench.h"
+
+#include "asset/io/IndexWidening.h"
+
+#include <cgltf.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace Bench
+{
+    namespace
+    {
+        /// A single in-memory glTF buffer / view / accessor, laid out like a parsed file.
+        struct Accessor
+        {
+            std::vector<std::uint8_t> bytes;
+            cgltf_buffer buffer{};
+            cgltf_buffer_view view{};
+            cgltf_accessor accessor{};
+
+            Accessor(std::vector<std::uint8_t> data, cgltf_component_type component, cgltf_type type, cgltf_size count)
+                : bytes(std::move(data))
+            {
+                buffer.data = bytes.data();
+                buffer.size = bytes.size();
+                view.buffer = &buffer;
+                view.size = bytes.size();
+                accessor.buffer_view = &view;
+                accessor.component_type = component;
+                accessor.type = type;
+                accessor.count = count;
+                accessor.stride = cgltf_component_size(component) * cgltf_num_components(type);
+            }
+        };
+
+        template <typename T>
+        Accessor makeIndices(std::size_t count, cgltf_component_type component, std::uint32_t maxValue)
+        {
+            std::mt19937 rng(42);
+            std::uniform_int_distribution<std::uint32_t> dist(0, maxValue);
+            std::vector<std::uint8_t> bytes(count * sizeof(T));
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const T v = static_cast<T>(dist(rng));
+                std::memcpy(bytes.data() + i * sizeof(T), &v, sizeof(T));
+            }
+            return Accessor(std::move(bytes), component, cgltf_type_scalar, count);
+        }
+
+        /// The importer's fallback: one cgltf_accessor_read_index per index.
+        void perElement(const cgltf_accessor &a, std::uint32_t *dst)
+        {
+            for (cgltf_size i = 0; i < a.count; ++i)
+                dst[i] = static_cast<std::uint32_t>(cgltf_accessor_read_index(&a, i));
+        }
+
+        template <typename Kernel>
+        void compareIndices(const Options &opt, const char *label, const Accessor &src, Kernel &&kernel)
+        {
+            const std::size_t count = static_cast<std::size_t>(src.accessor.count);
+            std::vector<std::uint32_t> ref(count), out(count);
+
+            const double base = bestOfMs(opt.runs, [&]
+                                         { perElement(src.accessor, ref.data()); });
+            const double fast = bestOfMs(opt.runs, [&]
+                                         { kernel(src.bytes.data(), count, out.data()); });
+
+            std::printf(" %s (%zu indices)%s\n", label, count, ref == out ? "" : "  ** MISMATCH **");
+            report("cgltf_accessor_read_index loop", base, base);
+            report(Asset::indexWideningPath(), fast, base);
+        }
+    } // namespace
+
+    void runIndexWidening(const Options &opt)
+    {
+        const std::size_t indexCount = scaled(opt, 6'000'000);
+
+        // 1) Index accessors: per-element reads vs. the widening kernel of the build
+        compareIndices(opt, "u8", makeIndices<std::uint8_t>(indexCount, cgltf_component_type_r_8u, 0xFFu),
+                       [](const std::uint8_t *src, std::size_t n, std::uint32_t *dst)
+                       { Asset::widenIndicesU8(src, n, dst); });
+        compareIndices(opt, "u16", makeIndices<std::uint16_t>(indexCount, cgltf_component_type_r_16u, 0xFFFFu),
+                       [](const std::uint8_t *src, std::size_t n, std::uint32_t *dst)
+                       { Asset::widenIndicesU16(reinterpret_cast<const std::uint16_t *>(src), n, dst); });
+        compareIndices(opt, "u32", makeIndices<std::uint32_t>(indexCount, cgltf_component_type_r_32u, 0xFFFFFFu),
+                       [](const std::uint8_t *src, std::size_t n, std::uint32_t *dst)
+                       { Asset::copyIndicesU32(reinterpret_cast<const std::uint32_t *>(src), n, dst); });
+
+        // 2) Tightly packed float3 attribute: cgltf_accessor_unpack_floats vs. memcpy
+        const std::size_t vertexCount = scaled(opt, 2'000'000);
+        std::vector<std::uint8_t> bytes(vertexCount * 3 * sizeof(float));
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+        for (std::size_t i = 0; i < vertexCount * 3; ++i)
+        {
+            const float v = dist(rng);
+            std::memcpy(bytes.data() + i * sizeof(float), &v, sizeof(float));
+        }
+        const Accessor positions(std::move(bytes), cgltf_component_type_r_32f, cgltf_type_vec3, vertexCount);
+
+        std::vector<float> ref(vertexCount * 3), out(vertexCount * 3);
+        const double base = bestOfMs(opt.runs, [&]
+                                     { cgltf_accessor_unpack_floats(&positions.accessor, ref.data(), ref.size()); });
+        const double fast = bestOfMs(opt.runs, [&]
+                                     { std::memcpy(out.data(), positions.bytes.data(), out.size() * sizeof(float)); });
+
+        std::printf(" float3 (%zu vertices)%s\n", vertexCount, ref == out ? "" : "  ** MISMATCH **");
+        report("cgltf_accessor_unpack_floats", base, base);
+        report("memcpy", fast, base);
+    }
+
+} // namespace Bench
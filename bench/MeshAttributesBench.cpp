@@ -0,0 +1,142 @@
+#include "Bench.h"
+
+#include "asset/MeshData.h"
+#include "asset/processing/MeshAttributes.h"
+#include "core/ParallelFor.h"
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Bench
+{
+    namespace
+    {
+        /// Wavy grid with ~@p triangles triangles, UVs along the grid axes.
+        Asset::MeshData makeGrid(std::size_t triangles)
+        {
+            const std::size_t side = std::max<std::size_t>(2, static_cast<std::size_t>(std::sqrt(double(triangles) / 2.0)) + 1);
+
+            Asset::MeshData md;
+            md.positions.reserve(side * side * 3);
+            md.texcoords.reserve(side * side * 2);
+            for (std::size_t z = 0; z < side; ++z)
+                for (std::size_t x = 0; x < side; ++x)
+                {
+                    const float fx = float(x), fz = float(z);
+                    md.positions.insert(md.positions.end(), {fx, 0.25f * std::sin(0.1f * fx) * std::cos(0.13f * fz), fz});
+                    md.texcoords.insert(md.texcoords.end(), {fx / float(side - 1), fz / float(side - 1)});
+                }
+
+            md.indices.reserve((side - 1) * (side - 1) * 6);
+            for (std::size_t z = 0; z + 1 < side; ++z)
+                for (std::size_t x = 0; x + 1 < side; ++x)
+                {
+                    const auto v = static_cast<Asset::MeshData::Index>(z * side + x);
+                    const auto s = static_cast<Asset::MeshData::Index>(side);
+                    md.indices.insert(md.indices.end(), {v, v + s, v + 1, v + 1, v + s, v + s + 1});
+                }
+            return md;
+        }
+
+        /// The glTF importer's tangent generator before Asset::Processing::ComputeTangents
+        /// (serial, AoS gathers through glm, per-triangle division), kept as the baseline.
+        void referenceTangents(Asset::MeshData &md)
+        {
+            const size_t vcount = md.positions.size() / 3;
+            std::vector<glm::vec3> T(vcount, glm::vec3(0.0f));
+            std::vector<glm::vec3> B(vcount, glm::vec3(0.0f));
+
+            auto V3 = [&](size_t i)
+            { return glm::vec3(md.positions[3 * i + 0], md.positions[3 * i + 1], md.positions[3 * i + 2]); };
+            auto N3 = [&](size_t i)
+            { return glm::vec3(md.normals[3 * i + 0], md.normals[3 * i + 1], md.normals[3 * i + 2]); };
+            auto UV2 = [&](size_t i)
+            { return glm::vec2(md.texcoords[2 * i + 0], md.texcoords[2 * i + 1]); };
+
+            for (size_t i = 0; i + 2 < md.indices.size(); i += 3)
+            {
+                const uint32_t i0 = md.indices[i + 0], i1 = md.indices[i + 1], i2 = md.indices[i + 2];
+                const glm::vec3 p0 = V3(i0), p1 = V3(i1), p2 = V3(i2);
+                const glm::vec2 w0 = UV2(i0), w1 = UV2(i1), w2 = UV2(i2);
+                const glm::vec3 dp1 = p1 - p0, dp2 = p2 - p0;
+                const glm::vec2 duv1 = w1 - w0, duv2 = w2 - w0;
+
+                const float denom = duv1.x * duv2.y - duv1.y * duv2.x;
+                if (std::abs(denom) < 1e-8f)
+                    continue;
+                const float r = 1.0f / denom;
+                const glm::vec3 t = (dp1 * duv2.y - dp2 * duv1.y) * r;
+                const glm::vec3 b = (dp2 * duv1.x - dp1 * duv2.x) * r;
+                T[i0] += t, T[i1] += t, T[i2] += t;
+                B[i0] += b, B[i1] += b, B[i2] += b;
+            }
+
+            md.tangents.resize(vcount * 4);
+            for (size_t i = 0; i < vcount; ++i)
+            {
+                const glm::vec3 n = glm::normalize(N3(i));
+                glm::vec3 t = T[i];
+                if (glm::dot(t, t) < 1e-12f)
+                {
+                    const glm::vec3 ref = (std::abs(n.z) < 0.999f) ? glm::vec3(0, 0, 1) : glm::vec3(0, 1, 0);
+                    t = glm::normalize(glm::cross(ref, n));
+                }
+                t = glm::normalize(t - n * glm::dot(n, t));
+                const float w = (glm::dot(glm::cross(n, t), B[i]) < 0.0f) ? -1.0f : 1.0f;
+                md.tangents[4 * i + 0] = t.x;
+                md.tangents[4 * i + 1] = t.y;
+                md.tangents[4 * i + 2] = t.z;
+                md.tangents[4 * i + 3] = w;
+            }
+        }
+
+        /// Fraction of vertices whose frames agree (dot > 0.999, same handedness).
+        double agreement(const std::vector<float> &a, const std::vector<float> &b)
+        {
+            std::size_t same = 0;
+            const std::size_t n = a.size() / 4;
+            for (std::size_t v = 0; v < n; ++v)
+            {
+                const float d = a[4 * v] * b[4 * v] + a[4 * v + 1] * b[4 * v + 1] + a[4 * v + 2] * b[4 * v + 2];
+                same += d > 0.999f && a[4 * v + 3] == b[4 * v + 3];
+            }
+            return n ? double(same) / double(n) : 1.0;
+        }
+    } // namespace
+
+    void runMeshAttributes(const Options &opt)
+    {
+        Asset::MeshData md = makeGrid(scaled(opt, 10'000'000));
+        const unsigned hw = Core::resolveThreadCount(0);
+        std::printf(" grid: %zu triangles, %zu vertices, %u hardware threads\n",
+                    md.indices.size() / 3, md.vertexCount(), hw);
+
+        // 1) Normals (no previous implementation: the importer substituted +Y)
+        Asset::Processing::AttributeSettings serial{};
+        serial.threadCount = 1;
+        const double normals1 = bestOfMs(opt.runs, [&]
+                                         { Asset::Processing::ComputeNormals(md, serial); });
+        const double normalsN = bestOfMs(opt.runs, [&]
+                                         { Asset::Processing::ComputeNormals(md); });
+        report("ComputeNormals, 1 thread", normals1, normals1);
+        std::printf("  %-34s %9.3f ms  %6.2fx  (%u threads)\n", "ComputeNormals, all threads", normalsN, normals1 / normalsN, hw);
+
+        // 2) Tangents against the old serial generator
+        Asset::MeshData ref = md;
+        const double base = bestOfMs(opt.runs, [&]
+                                     { referenceTangents(ref); });
+        const double tangents1 = bestOfMs(opt.runs, [&]
+                                          { Asset::Processing::ComputeTangents(md, serial); });
+        const double tangentsN = bestOfMs(opt.runs, [&]
+                                          { Asset::Processing::ComputeTangents(md); });
+
+        std::printf(" tangents (%.4f%% of frames agree with the reference)\n", 100.0 * agreement(ref.tangents, md.tangents));
+        report("old GenerateTangents (serial)", base, base);
+        report("ComputeTangents, 1 thread", tangents1, base);
+        std::printf("  %-34s %9.3f ms  %6.2fx  (%u threads)\n", "ComputeTangents, all threads", tangentsN, base / tangentsN, hw);
+    }
+
+} // namespace Bench
@@ -1,12 +1,45 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <vector>
 #include <glm/mat4x4.hpp>
 
 namespace Asset
 {
 
+    /**
+     * @brief One level of detail: a contiguous range of MeshData::indices.
+     *
+     * All levels share the mesh's vertex streams. error is the simplification error
+     * bound in mesh-local units (0 for the full-detail level).
+     */
+    struct MeshLod
+    {
+        std::uint32_t firstIndex = 0;
+        std::uint32_t indexCount = 0;
+        float error = 0.0f;
+    };
+
+    /**
+     * @brief A cluster of LOD 0 triangles with culling bounds (see BuildMeshlets).
+     *
+     * The triangles are the contiguous range [firstIndex, firstIndex + indexCount) of
+     * MeshData::indices. center/radius bound them in mesh-local space; the cluster is
+     * back-facing for a viewer at V when
+     *   dot(normalize(center - V), coneAxis) >= coneCutoff + radius / length(center - V).
+     * coneCutoff >= 1 means the normals are too spread out for the cone test.
+     */
+    struct Meshlet
+    {
+        std::uint32_t firstIndex = 0;
+        std::uint32_t indexCount = 0;
+        float center[3] = {0.0f, 0.0f, 0.0f};
+        float radius = 0.0f;
+        float coneAxis[3] = {0.0f, 0.0f, 0.0f};
+        float coneCutoff = 1.0f;
+    };
+
     /**
      * @brief CPU-side mesh container used by importers and uploaders.
      *
@@ -14,7 +47,11 @@ namespace Asset
      * - positions: xyzxyz... (size = 3 * vertexCount)
      * - normals:   nxnynz... (optional; size == positions.size())
      * - texcoords: uvuv...   (optional; size = 2 * vertexCount)
+     * - tangents:  xyzw...   (optional; size = 4 * vertexCount, w = bitangent sign)
      * - indices:   32-bit triangle indices (3 * triangleCount)
+     * - lods:      optional LOD chain, finest first; each level is a range of indices.
+     *              Empty means all indices form LOD 0.
+     * - meshlets:  optional clusters partitioning the LOD 0 range (for per-cluster culling).
      *
      * localTransform stores the node's world transform from the source asset.
      * You can choose to bake it on upload or keep it separate.
@@ -28,6 +65,8 @@ namespace Asset
         std::vector<float> texcoords; // uvuv...   (optional)
         std::vector<float> tangents;  // 4 * V  (x,y,z,w), optional
         std::vector<Index> indices;   // triangle indices (3*i)
+        std::vector<MeshLod> lods;    // optional, ranges into indices (LOD 0 first)
+        std::vector<Meshlet> meshlets; // optional, clusters of the LOD 0 range
 
         glm::mat4 localTransform{1.0f};
 
@@ -36,7 +75,30 @@ namespace Asset
         [[nodiscard]] std::size_t indexCount() const noexcept { return indices.size(); }
         [[nodiscard]] bool hasNormals() const noexcept { return normals.size() == positions.size(); }
         [[nodiscard]] bool hasTexcoord0() const noexcept { return texcoords.size() == vertexCount() * 2; }
+        [[nodiscard]] bool hasTangents() const noexcept { return tangents.size() == vertexCount() * 4; }
         [[nodiscard]] bool empty() const noexcept { return positions.empty(); }
+        /// Index count of the full-detail level (coarser LODs are appended after it).
+        [[nodiscard]] std::size_t baseIndexCount() const noexcept { return lods.empty() ? indices.size() : lods.front().indexCount; }
+
+        /**
+         * @brief Call fn(stream, componentsPerVertex) for every present per-vertex stream.
+         *
+         * Positions come first. Generic passes (remap, reorder) go through this, so a new
+         * attribute only has to be listed here to be carried along.
+         */
+        template <typename Fn>
+        void forEachVertexStream(Fn &&fn)
+        {
+            // Presence is decided up front: fn may resize positions (and so vertexCount()).
+            const bool n = hasNormals(), uv = hasTexcoord0(), t = hasTangents();
+            fn(positions, std::size_t{3});
+            if (n)
+                fn(normals, std::size_t{3});
+            if (uv)
+                fn(texcoords, std::size_t{2});
+            if (t)
+                fn(tangents, std::size_t{4});
+        }
 
         // Clear all arrays; keep capacity as-is (use shrink_to_fit() if needed).
         void clear() noexcept
@@ -46,6 +108,8 @@ namespace Asset
             texcoords.clear();
             tangents.clear();
             indices.clear();
+            lods.clear();
+            meshlets.clear();
             localTransform = glm::mat4(1.0f);
         }
 
@@ -57,7 +121,50 @@ namespace Asset
             texcoords.shrink_to_fit();
             tangents.shrink_to_fit();
             indices.shrink_to_fit();
+            lods.shrink_to_fit();
+            meshlets.shrink_to_fit();
         }
     };
 
+    /**
+     * @brief Non-owning, read-only view of MeshData streams.
+     *
+     * Same layout rules as MeshData. Used by the upload path so that both freshly
+     * imported meshes and memory-mapped cache entries can be consumed uniformly.
+     */
+    struct MeshDataView
+    {
+        std::span<const float> positions;
+        std::span<const float> normals;
+        std::span<const float> texcoords;
+        std::span<const float> tangents;
+        std::span<const MeshData::Index> indices;
+        std::span<const MeshLod> lods;
+        std::span<const Meshlet> meshlets;
+
+        glm::mat4 localTransform{1.0f};
+
+        MeshDataView() = default;
+
+        MeshDataView(const MeshData &md) noexcept
+            : positions(md.positions),
+              normals(md.normals),
+              texcoords(md.texcoords),
+              tangents(md.tangents),
+              indices(md.indices),
+              lods(md.lods),
+              meshlets(md.meshlets),
+              localTransform(md.localTransform)
+        {
+        }
+
+        [[nodiscard]] std::size_t vertexCount() const noexcept { return positions.size() / 3; }
+        [[nodiscard]] std::size_t indexCount() const noexcept { return indices.size(); }
+        [[nodiscard]] bool hasNormals() const noexcept { return normals.size() == positions.size(); }
+        [[nodiscard]] bool hasTexcoord0() const noexcept { return texcoords.size() == vertexCount() * 2; }
+        [[nodiscard]] bool hasTangents() const noexcept { return tangents.size() == vertexCount() * 4; }
+        [[nodiscard]] bool empty() const noexcept { return positions.empty(); }
+        [[nodiscard]] std::size_t baseIndexCount() const noexcept { return lods.empty() ? indices.size() : lods.front().indexCount; }
+    };
+
 } // namespace Asset
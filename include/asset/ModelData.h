@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/mat4x4.hpp>
+
+#include "asset/MeshData.h"
+
+namespace Asset
+{
+
+    /**
+     * @brief One placement of a unique geometry in the world.
+     *
+     * meshIndex indexes ModelData::meshes; transform is the full local→world matrix
+     * (node hierarchy, plus the per-instance TRS for EXT_mesh_gpu_instancing).
+     */
+    struct MeshInstance
+    {
+        std::uint32_t meshIndex = 0;
+        glm::mat4 transform{1.0f};
+    };
+
+    /**
+     * @brief Result of importing a model: unique geometry + instances referencing it.
+     *
+     * A source mesh used by N nodes is decoded once and appears N times in instances.
+     * MeshData::localTransform of unique geometry is identity; placement lives in instances.
+     */
+    struct ModelData
+    {
+        std::vector<MeshData> meshes;
+        std::vector<MeshInstance> instances;
+    };
+
+} // namespace Asset
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "asset/MeshData.h"
+#include "asset/ModelData.h"
+#include "asset/processing/MeshOptimize.h"
+#include "core/io/MappedFile.h"
+
+namespace Asset
+{
+
+    /**
+     * @brief Memory-mapped cache entry: MeshDataView spans point straight into the file.
+     *
+     * Keep this object alive for as long as any of the views are in use.
+     */
+    class CachedMeshes
+    {
+    public:
+        [[nodiscard]] const std::vector<MeshDataView> &meshes() const noexcept { return meshes_; }
+        [[nodiscard]] const std::vector<MeshInstance> &instances() const noexcept { return instances_; }
+
+    private:
+        friend class MeshCache;
+
+        Core::IO::MappedFile file_;
+        std::vector<MeshDataView> meshes_;
+        std::vector<MeshInstance> instances_;
+    };
+
+    /**
+     * @brief Persistent on-disk cache of post-processed model geometry (MeshData incl. LOD ranges + instances).
+     *
+     * - Key = hash(source bytes [+ external .bin buffers]) mixed with OptimizeSettings
+     *   and the cache format version, so any change to inputs invalidates the entry.
+     * - One versioned binary file per key: <directory>/<key-hex>.omesh
+     * - load() memory-maps the file and validates header/ranges; any mismatch is a miss.
+     * - store() writes to a temporary file and renames it into place.
+     *
+     * The format is native little-endian and not meant to be shipped between machines.
+     */
+    class MeshCache
+    {
+    public:
+        /// Bump whenever the on-disk layout or the meaning of cached data changes.
+        static constexpr std::uint32_t kFormatVersion = 6;
+
+        explicit MeshCache(std::filesystem::path directory);
+
+        /// Compute the cache key for @p sourcePath processed with @p settings.
+        /// Returns std::nullopt if the source (or one of its buffers) can't be read.
+        [[nodiscard]] static std::optional<std::uint64_t> computeKey(const std::string &sourcePath,
+                                                                     const Processing::OptimizeSettings &settings);
+
+        /// Map a cache entry. Returns std::nullopt on miss / stale / corrupt file.
+        [[nodiscard]] std::optional<CachedMeshes> load(std::uint64_t key) const;
+
+        /// Write @p model (unique geometry + instances) as entry @p key.
+        /// Returns false (and logs) on I/O failure.
+        bool store(std::uint64_t key, const ModelData &model) const;
+
+        [[nodiscard]] std::filesystem::path entryPath(std::uint64_t key) const;
+
+    private:
+        std::filesystem::path directory_;
+    };
+
+} // namespace Asset
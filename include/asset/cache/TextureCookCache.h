@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+
+#include "asset/processing/TextureCook.h"
+
+namespace Asset
+{
+
+    /**
+     * @brief Persistent on-disk cache of cooked textures (CPU mip chain + block compression).
+     *
+     * - Key = hash(bytes of every source image) mixed with the codec, color space,
+     *   a caller-defined variant (how the sources are combined) and the format version.
+     * - One KTX2-style file per key: <directory>/<key-hex>.oktx — a header, a level
+     *   index (offset/size/extent per mip) and the level payloads, 16-byte aligned,
+     *   so a loader can upload the whole chain with one copy.
+     * - store() writes to a temporary file and renames it into place.
+     *
+     * Source hashes are memoized per path (size + mtime), so planning and loading
+     * the same material doesn't read its images twice.
+     */
+    class TextureCookCache
+    {
+    public:
+        /// Bump whenever the on-disk layout or an encoder's output changes.
+        static constexpr std::uint32_t kFormatVersion = 1;
+
+        explicit TextureCookCache(std::filesystem::path directory);
+
+        /// Key for @p sources cooked to @p codec; std::nullopt if a source can't be read.
+        [[nodiscard]] std::optional<std::uint64_t> computeKey(std::span<const std::string> sources,
+                                                              Processing::TextureCodec codec, bool srgb,
+                                                              std::uint64_t variant = 0) const;
+
+        /// True if a valid-looking entry exists for @p key (reads the header only); optionally returns its tag.
+        [[nodiscard]] bool contains(std::uint64_t key, std::uint32_t *tag = nullptr) const;
+
+        /// Read an entry. Returns std::nullopt on miss / stale / corrupt file.
+        [[nodiscard]] std::optional<Processing::CookedTexture> load(std::uint64_t key) const;
+
+        /// Write @p texture as entry @p key. Returns false (and logs) on I/O failure.
+        bool store(std::uint64_t key, const Processing::CookedTexture &texture) const;
+
+        [[nodiscard]] std::filesystem::path entryPath(std::uint64_t key) const;
+
+    private:
+        struct SourceHash
+        {
+            std::uintmax_t size = 0;
+            std::filesystem::file_time_type mtime{};
+            std::uint64_t hash = 0;
+        };
+
+        std::filesystem::path directory_;
+        mutable std::map<std::string, SourceHash> sourceHashes_;
+    };
+
+} // namespace Asset
@@ -3,24 +3,44 @@
 #include <string>
 #include <vector>
 
-#include "asset/MeshData.h"
+#include "asset/ModelData.h"
 
 namespace Asset
 {
 
+    struct GltfLoadOptions
+    {
+        // Worker threads for primitive decoding: 0 = hardware concurrency, 1 = serial.
+        unsigned threadCount = 0;
+
+        // Serve .gltf/.glb/.bin bytes from read-only file mappings (no heap copy of buffers).
+        bool memoryMap = true;
+    };
+
     /**
-     * @brief Loads meshes from a glTF file into CPU-side MeshData containers.
+     * @brief Loads a glTF file into unique CPU-side geometry plus instances.
      *
      * - Supports positions, normals, and TEXCOORD_0 (if present).
+     * - Attributes may be float or quantized integer accessors (KHR_mesh_quantization);
+     *   normalized ints are mapped to [-1,1]/[0,1], quantized normals/tangents renormalized.
+     * - EXT_meshopt_compression buffer views are decoded with meshoptimizer before reading.
      * - Fills MeshData::indices (uses sequential 0..N-1 if primitive has no indices).
-     * - Writes node's world transform into MeshData::localTransform.
+     * - Missing normals are computed (area-weighted); missing tangents are computed
+     *   when TEXCOORD_0 is present (see Processing::ComputeNormals/ComputeTangents).
+     * - Each (mesh, primitive) referenced by any node is decoded once; every node
+     *   that uses it becomes a MeshInstance with its world transform.
+     * - EXT_mesh_gpu_instancing TRANSLATION/ROTATION/SCALE expand into extra instances.
+     * - World transforms come from one top-down pass over the node hierarchy.
      * - Only triangle primitives are imported; others are skipped with a warning.
+     * - Primitives are decoded (attributes, indices, tangents) on worker threads;
+     *   output order is deterministic (mesh/primitive order for geometry,
+     *   node order for instances).
      */
     class GltfLoader
     {
     public:
-        /// Load meshes from a glTF file at @p path. Throws std::runtime_error on failure.
-        [[nodiscard]] static std::vector<MeshData> loadMeshes(const std::string &path);
+        /// Load a glTF file at @p path. Throws std::runtime_error on failure.
+        [[nodiscard]] static ModelData loadModel(const std::string &path, const GltfLoadOptions &opts = {});
     };
 
 } // namespace Asset
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+#include <cgltf.h>
+
+namespace Asset
+{
+
+    /// Totals reported by decodeMeshoptBufferViews (for throughput logs).
+    struct MeshoptDecodeStats
+    {
+        std::size_t bufferViews = 0;     // compressed views decoded
+        std::size_t compressedBytes = 0; // input size
+        std::size_t decodedBytes = 0;    // output size
+        double milliseconds = 0.0;       // wall time
+
+        [[nodiscard]] double megabytesPerSecond() const noexcept
+        {
+            return milliseconds > 0.0 ? (double(decodedBytes) / (1024.0 * 1024.0)) / (milliseconds / 1000.0) : 0.0;
+        }
+    };
+
+    /**
+     * @brief Decode every EXT_meshopt_compression buffer view in @p data in place.
+     *
+     * Decoded bytes are attached as cgltf_buffer_view::data (owned and freed by cgltf_free),
+     * so regular accessor reads see plain, uncompressed data afterwards.
+     * Views are independent and decoded on up to @p threadCount threads (0 = all cores).
+     *
+     * @throws std::runtime_error if a view can't be decoded (corrupt stream / missing buffer).
+     */
+    MeshoptDecodeStats decodeMeshoptBufferViews(cgltf_data &data, unsigned threadCount);
+
+} // namespace Asset
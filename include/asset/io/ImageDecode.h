@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Asset
+{
+
+    /// Frees pixels returned by stb_image (stbi_image_free).
+    struct DecodedPixelsDeleter
+    {
+        void operator()(unsigned char *pixels) const noexcept;
+    };
+
+    /// One decoded image file, tightly packed rows of width * components bytes.
+    struct DecodedImage
+    {
+        std::string path;
+        int channels = 4;   // requested channel count (1..4, or 0 = the file's own)
+        int components = 0; // channels per pixel in pixels (= channels unless 0 was requested)
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::unique_ptr<unsigned char, DecodedPixelsDeleter> pixels;
+        double decodeMs = 0.0;
+        std::string error; // stb failure reason when pixels is null
+
+        [[nodiscard]] bool ok() const noexcept { return pixels != nullptr; }
+        [[nodiscard]] std::size_t bytes() const noexcept { return std::size_t(width) * height * components; }
+    };
+
+    /// Totals of the last ImageDecodeBatch::decodeAll() (for load logs).
+    struct ImageDecodeStats
+    {
+        std::size_t images = 0;
+        std::size_t failed = 0;
+        std::size_t decodedBytes = 0;
+        double decodeMsTotal = 0.0; // sum of per-image times (includes time-slicing when threads > cores)
+        double wallMs = 0.0;        // elapsed time of the whole batch
+        unsigned threads = 0;
+    };
+
+    /**
+     * @brief Decodes a set of image files on worker threads, ahead of GPU upload.
+     *
+     * Callers first request() every (path, channel count) they will need, then
+     * decodeAll() runs stbi_load for all of them in parallel; results are looked up
+     * with find() on the render thread, which only records the uploads.
+     *
+     * - Duplicate requests are decoded once (materials often share maps).
+     * - A file that fails to decode does not throw; its entry carries the error and
+     *   the consumer decides between a fallback and an exception.
+     */
+    class ImageDecodeBatch
+    {
+    public:
+        /// Queue @p path for decoding to @p channels (1..4) per pixel, or 0 for the file's native
+        /// count (gray, gray + alpha, RGB, RGBA); empty paths are ignored.
+        void request(const std::string &path, int channels);
+
+        /// Decode every pending request on up to @p threadCount threads (0 = all cores).
+        ImageDecodeStats decodeAll(unsigned threadCount = 0);
+
+        /// Decoded entry for a previous request, or nullptr if it was never requested.
+        [[nodiscard]] const DecodedImage *find(const std::string &path, int channels) const;
+
+        [[nodiscard]] std::size_t size() const noexcept { return images_.size(); }
+
+    private:
+        std::vector<DecodedImage> images_;
+        std::map<std::pair<std::string, int>, std::size_t> index_;
+    };
+
+} // namespace Asset
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Asset
+{
+
+    /**
+     * @brief Bulk index widening kernels used by the importers.
+     *
+     * Sources may be unaligned (glTF buffer views only guarantee component alignment).
+     * Paths are chosen at compile time: AVX2 when the build enables it
+     * (OME3D_ENABLE_AVX2), SSE2 on any x86-64 target, plain loops elsewhere.
+     */
+    void widenIndicesU8(const std::uint8_t *src, std::size_t count, std::uint32_t *dst) noexcept;
+    void widenIndicesU16(const std::uint16_t *src, std::size_t count, std::uint32_t *dst) noexcept;
+    void copyIndicesU32(const std::uint32_t *src, std::size_t count, std::uint32_t *dst) noexcept;
+
+    /// Name of the compiled-in widening path ("AVX2", "SSE2" or "scalar"), for logs.
+    const char *indexWideningPath() noexcept;
+
+} // namespace Asset
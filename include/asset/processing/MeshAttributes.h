@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+
+#include "asset/MeshData.h"
+
+namespace Asset::Processing
+{
+
+    struct AttributeSettings
+    {
+        // Worker threads: 0 = hardware concurrency, 1 = serial.
+        unsigned threadCount = 0;
+
+        // Upper bound for per-thread accumulation buffers (limits workers on huge meshes).
+        std::size_t maxScratchBytes = 512ull * 1024ull * 1024ull;
+    };
+
+    /**
+     * @brief Compute smooth, area-weighted vertex normals into md.normals (overwrites).
+     *
+     * Each triangle contributes its unnormalized face normal (|cross| = 2 * area) to its
+     * three corners. Triangles are split across workers, each accumulating into its own
+     * buffer (no atomics); buffers are then reduced per vertex range and normalized.
+     */
+    void ComputeNormals(MeshData &md, const AttributeSettings &s = {});
+
+    /**
+     * @brief Compute per-vertex tangent frames into md.tangents (xyz + handedness w).
+     *
+     * Requires normals and TEXCOORD_0. Per-triangle dP/du and dP/dv are weighted by the
+     * triangle's UV-space area, accumulated like ComputeNormals, then Gram-Schmidt
+     * orthogonalized against the vertex normal. Degenerate frames get an arbitrary
+     * tangent perpendicular to the normal.
+     *
+     * @return false (md untouched) if normals/UVs are missing or there are no triangles.
+     */
+    bool ComputeTangents(MeshData &md, const AttributeSettings &s = {});
+
+} // namespace Asset::Processing
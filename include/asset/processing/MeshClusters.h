@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+#include "asset/MeshData.h"
+
+namespace Asset::Processing
+{
+
+    struct MeshletSettings
+    {
+        // Cluster size limits (meshopt: maxVertices <= 256, maxTriangles <= 512 and divisible by 4).
+        std::uint32_t maxVertices = 64;
+        std::uint32_t maxTriangles = 124;
+        // 0..1: how much the builder favours tight normal cones over compact spheres.
+        float coneWeight = 0.25f;
+    };
+
+    /**
+     * @brief Split the LOD 0 triangles of @p md into meshlets with culling bounds.
+     *
+     * The LOD 0 index range is rewritten in cluster order (each meshlet's triangles become
+     * a contiguous run of ordinary 32-bit indices) and md.meshlets receives one entry per
+     * cluster with its bounding sphere and normal cone. Coarser LODs and the vertex streams
+     * are left alone, so this can run before or after the vertex fetch pass.
+     *
+     * Any existing meshlets are discarded first; an empty mesh ends up with none.
+     */
+    void BuildMeshlets(MeshData &md, const MeshletSettings &s = {});
+
+} // namespace Asset::Processing
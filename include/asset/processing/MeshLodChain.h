@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include "asset/MeshData.h"
+
+namespace Asset::Processing
+{
+
+    struct LodSettings
+    {
+        // Total number of levels, including the full-detail LOD 0.
+        std::uint32_t maxLevels = 6;
+        // Each level targets this fraction of the previous level's indices.
+        float reductionRatio = 0.5f;
+        // Error budget per simplification step, relative to the mesh extent (meshopt convention).
+        float maxStepError = 0.05f;
+        // Don't produce levels below this many triangles.
+        std::uint32_t minTriangles = 64;
+        // Stop when a step removes less than this fraction of triangles (simplifier is stuck).
+        float minReduction = 0.1f;
+    };
+
+    /**
+     * @brief Build a chain of LODs over the shared vertex streams of @p md.
+     *
+     * Each level is simplified from the previous one and appended to md.indices;
+     * md.lods receives one range per level (LOD 0 = the current full-detail indices).
+     * MeshLod::error is a conservative bound in mesh-local units: the sum of the
+     * absolute errors of all steps that led to the level.
+     *
+     * Any existing chain is discarded first. Vertex streams are not touched, so run
+     * this after vertex reordering (OptimizeMeshInPlace calls it as its last pass).
+     */
+    void GenerateLodChain(MeshData &md, const LodSettings &s = {});
+
+} // namespace Asset::Processing
@@ -1,7 +1,11 @@
 #pragma once
+#include <algorithm>
+#include <cstddef>
 #include <vector>
 #include <glm/glm.hpp>
 #include "asset/MeshData.h"
+#include "asset/processing/MeshClusters.h"
+#include "asset/processing/MeshLodChain.h"
 
 namespace Asset::Processing
 {
@@ -25,13 +29,53 @@ namespace Asset::Processing
         float simplifyTargetRatio = 0.5f;
         // Allowed geometric error for simplification.
         float simplifyError = 1e-2f;
+
+        // Append a chain of coarser LODs as index ranges over the same vertices (see GenerateLodChain).
+        bool generateLods = false;
+        LodSettings lod{};
+
+        // Split LOD 0 into meshlets with bounds for per-cluster culling (see BuildMeshlets).
+        bool buildMeshlets = false;
+        MeshletSettings meshlet{};
+    };
+
+    /// Per-pass timings and scratch high-water mark of OptimizeMeshInPlace.
+    struct OptimizeStats
+    {
+        double remapMs = 0.0;
+        double cacheMs = 0.0;
+        double overdrawMs = 0.0;
+        double fetchMs = 0.0;
+        double simplifyMs = 0.0;
+        double lodMs = 0.0;
+        double meshletMs = 0.0;
+
+        // Largest amount of temporary memory (remap tables, stream copies) held at once.
+        std::size_t peakScratchBytes = 0;
+
+        double totalMs() const noexcept { return remapMs + cacheMs + overdrawMs + fetchMs + simplifyMs + lodMs + meshletMs; }
+
+        // Sum timings, keep the largest peak (meshes are optimized one after another).
+        void accumulate(const OptimizeStats &o) noexcept
+        {
+            remapMs += o.remapMs;
+            cacheMs += o.cacheMs;
+            overdrawMs += o.overdrawMs;
+            fetchMs += o.fetchMs;
+            simplifyMs += o.simplifyMs;
+            lodMs += o.lodMs;
+            meshletMs += o.meshletMs;
+            peakScratchBytes = std::max(peakScratchBytes, o.peakScratchBytes);
+        }
     };
 
-    // Optimizes MeshData in-place.
-    // Expected layout:
-    //   positions: xyz xyz ...
-    //   normals:   nx ny nz ... (same count as positions; will be generated if missing)
-    //   texcoords: u v u v ...
-    void OptimizeMeshInPlace(MeshData &md, const OptimizeSettings &s = {});
+    // Optimizes MeshData in-place, directly on the SoA streams.
+    // Every present per-vertex stream (see MeshData::forEachVertexStream) takes part in
+    // deduplication and is remapped together with the indices; absent streams stay absent
+    // (a stream whose size doesn't match the vertex count is treated as absent and cleared).
+    // Nothing is generated here: missing normals/tangents are the importer's job.
+    // An existing LOD chain and meshlets are dropped (only LOD 0 is optimized) and rebuilt if
+    // generateLods / buildMeshlets are set.
+    void OptimizeMeshInPlace(MeshData &md, const OptimizeSettings &s = {}, OptimizeStats *stats = nullptr);
 
 } // namespace Asset::Processing
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Asset::Processing
+{
+
+    /// Storage of a cooked texture's texels (values are stored on disk; don't renumber).
+    enum class TextureCodec : std::uint32_t
+    {
+        RGBA8 = 0, ///< uncompressed, 4 bytes per texel (fallback when BC is unsupported)
+        BC7 = 1,   ///< RGBA, 16 bytes per 4x4 block (color, packed MR/ARM)
+        BC5 = 2,   ///< two channels (RG), 16 bytes per 4x4 block (tangent-space normals; Z is rebuilt in the shader)
+        BC4 = 3,   ///< one channel (R), 8 bytes per 4x4 block (AO, masks)
+        RG8 = 4,   ///< uncompressed R + G, 2 bytes per texel (BC fallback for two-channel maps)
+        R8 = 5,    ///< uncompressed R, 1 byte per texel (BC fallback for one-channel maps)
+    };
+
+    /// Texel footprint of @p codec: bytes per block and block edge in texels (1 for uncompressed codecs).
+    [[nodiscard]] std::uint32_t CodecBlockBytes(TextureCodec codec) noexcept;
+    [[nodiscard]] std::uint32_t CodecBlockDim(TextureCodec codec) noexcept;
+
+    /// One mip level inside CookedTexture::data.
+    struct CookedLevel
+    {
+        std::uint64_t offset = 0; // bytes from the start of data
+        std::uint64_t bytes = 0;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+    };
+
+    /// Full mip chain, largest level first, levels tightly packed back to back.
+    struct CookedTexture
+    {
+        TextureCodec codec = TextureCodec::RGBA8;
+        bool srgb = false;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::uint32_t tag = 0; // caller-defined, stored alongside the texels
+        std::vector<CookedLevel> levels;
+        std::vector<std::uint8_t> data;
+    };
+
+    /**
+     * @brief Build the mip chain of an RGBA8 image on the CPU and encode every level.
+     *
+     * - Mips halve each dimension (rounding down, min 1) like the GPU blit chain did;
+     *   2x2 box filter, averaged in linear space when @p srgb is set.
+     * - BC7 uses mode 6 (one subset, 7-bit RGBA endpoints + p-bits, 16 weights):
+     *   endpoints along the block's principal axis, refined once by least squares.
+     * - BC5/BC4 pick min/max endpoints in the 8-value mode; BC5 keeps R and G, BC4 keeps R.
+     * - RG8/R8 keep the first two / one channel of every texel.
+     * - Blocks of a level are encoded on up to @p threadCount threads (0 = all cores).
+     */
+    [[nodiscard]] CookedTexture CookTexture(const std::uint8_t *rgba, std::uint32_t width, std::uint32_t height,
+                                            TextureCodec codec, bool srgb, unsigned threadCount = 0);
+
+    /**
+     * @brief Like CookTexture() for a tangent-space normal map (R, G = X, Y in 0..255; Z is rebuilt).
+     *
+     * Mips average the unit normals instead of the encoded bytes. Every level stores the averaged
+     * direction's X, Y in R, G and the Toksvig variance (1 - |avg|) / |avg| (clamped to 1) in B,
+     * with A = 255. Level 0 has variance 0. @p codec must keep three channels (BC7 / RGBA8) for the
+     * shader to read the variance.
+     */
+    [[nodiscard]] CookedTexture CookNormalMap(const std::uint8_t *rgba, std::uint32_t width, std::uint32_t height,
+                                              TextureCodec codec, unsigned threadCount = 0);
+
+} // namespace Asset::Processing
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+namespace Core
+{
+
+    /**
+     * @brief Startup tunables read from a plain "key = value" file.
+     *
+     * Missing file or keys keep the defaults below; '#' starts a comment.
+     * Sizes must be positive, counts accept 0 (off) and switches accept 0 / 1.
+     * Unknown keys and out-of-range values are logged and ignored.
+     */
+    struct EngineConfig
+    {
+        /// Size of the persistently mapped staging ring used for all CPU→GPU copies.
+        std::uint32_t stagingRingMiB = 64;
+
+        /// Size of one geometry arena page's vertex / index buffer (meshes are suballocated from pages).
+        std::uint32_t geometryVertexPageMiB = 64;
+        std::uint32_t geometryIndexPageMiB = 32;
+
+        /// When set, load Render::StressScene with this many objects instead of the workshop room (0 = off).
+        std::uint32_t stressSceneObjects = 0;
+
+        /// Switch: 1 starts with the GPU-driven culling toggle on (devices with drawIndirectCount only).
+        std::uint32_t gpuDriven = 0;
+
+        /// When set, render this many frames, log the averaged frame timings ("Smoke: ...") and exit (0 = off).
+        std::uint32_t smokeFrames = 0;
+
+        /// When set, push this many MiB through every upload path after scene load and log MiB/s per path (0 = off).
+        std::uint32_t uploadBenchMiB = 0;
+
+        /// Load @p path on top of the defaults (never throws on a missing file).
+        [[nodiscard]] static EngineConfig load(const std::filesystem::path &path);
+    };
+
+} // namespace Core
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Core::Hash
+{
+
+    /**
+     * @brief Stable 64-bit content hash (xxHash64 algorithm).
+     *
+     * Used for on-disk cache keys, so the result must never depend on the process,
+     * the platform's std::hash or the build type. Input is read little-endian.
+     */
+    inline std::uint64_t hash64(const void *data, std::size_t size, std::uint64_t seed = 0) noexcept
+    {
+        constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ull;
+        constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr std::uint64_t P3 = 0x165667B19E3779F9ull;
+        constexpr std::uint64_t P4 = 0x85EBCA77C2B2AE63ull;
+        constexpr std::uint64_t P5 = 0x27D4EB2F165667C5ull;
+
+        auto rotl = [](std::uint64_t x, int r) noexcept
+        { return (x << r) | (x >> (64 - r)); };
+        auto read64 = [](const unsigned char *p) noexcept
+        {
+            std::uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        };
+        auto read32 = [](const unsigned char *p) noexcept
+        {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        };
+        auto round = [&](std::uint64_t acc, std::uint64_t input) noexcept
+        {
+            acc += input * P2;
+            acc = rotl(acc, 31);
+            return acc * P1;
+        };
+        auto merge = [&](std::uint64_t acc, std::uint64_t val) noexcept
+        {
+            acc ^= round(0, val);
+            return acc * P1 + P4;
+        };
+
+        const auto *p = static_cast<const unsigned char *>(data);
+        const unsigned char *const end = p + size;
+        std::uint64_t h;
+
+        if (size >= 32)
+        {
+            std::uint64_t v1 = seed + P1 + P2;
+            std::uint64_t v2 = seed + P2;
+            std::uint64_t v3 = seed;
+            std::uint64_t v4 = seed - P1;
+
+            const unsigned char *const limit = end - 32;
+            do
+            {
+                v1 = round(v1, read64(p));
+                v2 = round(v2, read64(p + 8));
+                v3 = round(v3, read64(p + 16));
+                v4 = round(v4, read64(p + 24));
+                p += 32;
+            } while (p <= limit);
+
+            h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+            h = merge(h, v1);
+            h = merge(h, v2);
+            h = merge(h, v3);
+            h = merge(h, v4);
+        }
+        else
+        {
+            h = seed + P5;
+        }
+
+        h += static_cast<std::uint64_t>(size);
+
+        while (p + 8 <= end)
+        {
+            h ^= round(0, read64(p));
+            h = rotl(h, 27) * P1 + P4;
+            p += 8;
+        }
+        if (p + 4 <= end)
+        {
+            h ^= static_cast<std::uint64_t>(read32(p)) * P1;
+            h = rotl(h, 23) * P2 + P3;
+            p += 4;
+        }
+        while (p < end)
+        {
+            h ^= static_cast<std::uint64_t>(*p) * P5;
+            h = rotl(h, 11) * P1;
+            ++p;
+        }
+
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    /// Mix a trivially copyable value into an existing hash (order-dependent).
+    template <typename T>
+    inline std::uint64_t combine(std::uint64_t seed, const T &value) noexcept
+    {
+        return hash64(&value, sizeof(T), seed);
+    }
+
+} // namespace Core::Hash
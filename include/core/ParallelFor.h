@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Core
+{
+
+    /// Resolve a user-facing thread count: 0 = all hardware threads, never less than 1.
+    inline unsigned resolveThreadCount(unsigned requested) noexcept
+    {
+        if (requested == 0)
+            requested = std::thread::hardware_concurrency();
+        return std::max(1u, requested);
+    }
+
+    /**
+     * @brief Run fn(i) for every i in [0, count) on up to @p threadCount threads.
+     *
+     * - Work is handed out dynamically (atomic counter), so uneven items balance out.
+     * - The calling thread participates; with threadCount == 1 it all runs inline.
+     * - The first exception thrown by fn is rethrown on the caller after all workers joined.
+     *
+     * Results must be written to per-index slots so output order stays deterministic.
+     */
+    template <typename Fn>
+    void parallelFor(std::size_t count, unsigned threadCount, Fn &&fn)
+    {
+        if (count == 0)
+            return;
+
+        const std::size_t workers = std::min<std::size_t>(resolveThreadCount(threadCount), count);
+        if (workers == 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                fn(i);
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::exception_ptr firstError;
+        std::mutex errorMutex;
+
+        auto worker = [&]()
+        {
+            for (;;)
+            {
+                const std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+                if (i >= count)
+                    return;
+                try
+                {
+                    fn(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!firstError)
+                        firstError = std::current_exception();
+                    next.store(count, std::memory_order_relaxed); // stop handing out work
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (std::size_t t = 1; t < workers; ++t)
+            threads.emplace_back(worker);
+
+        worker();
+
+        for (auto &th : threads)
+            th.join();
+
+        if (firstError)
+            std::rethrow_exception(firstError);
+    }
+
+} // namespace Core
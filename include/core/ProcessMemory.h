@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Core
+{
+
+    /// Peak resident set size (high-water mark) of this process in bytes; 0 if unavailable.
+    [[nodiscard]] std::size_t peakResidentSetBytes() noexcept;
+
+} // namespace Core
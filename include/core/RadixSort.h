@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Core
+{
+    /// 64-bit sort key with the index of the element it orders.
+    struct SortEntry
+    {
+        std::uint64_t key;
+        std::uint32_t value;
+    };
+
+    /**
+     * @brief Stable LSD radix sort of @p entries by key (8 passes of 8 bits).
+     *
+     * Passes whose digit is the same for every key are skipped, so keys that only use
+     * some of their bits cost proportionally less. @p scratch is resized as needed and
+     * can be kept by the caller to avoid allocating every frame.
+     */
+    void radixSort(std::vector<SortEntry> &entries, std::vector<SortEntry> &scratch);
+
+} // namespace Core
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <chrono>
+
+namespace Core
+{
+
+    /**
+     * @brief Minimal monotonic stopwatch for coarse CPU timings (load times, passes).
+     *
+     * Usage:
+     *   Core::Stopwatch sw;
+     *   doWork();
+     *   CORE_LOG_INFO("took " + std::to_string(sw.elapsedMs()) + " ms");
+     */
+    class Stopwatch
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        Stopwatch() noexcept : start_(Clock::now()) {}
+
+        /// Restart measuring from "now".
+        void reset() noexcept { start_ = Clock::now(); }
+
+        /// Elapsed time in milliseconds since construction / last reset().
+        [[nodiscard]] double elapsedMs() const noexcept
+        {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start_).count();
+        }
+
+    private:
+        Clock::time_point start_;
+    };
+
+} // namespace Core
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Core::IO
+{
+
+    /**
+     * @brief RAII read-only memory mapping of a whole file.
+     *
+     * - open() maps the file; returns false (and leaves the object empty) on failure.
+     * - The mapping stays valid until close() / destruction; move-only.
+     * - Empty files are reported as a failed open (nothing to map).
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile() noexcept { close(); }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        /// Map @p path read-only. Closes any previous mapping first.
+        bool open(const std::string &path) noexcept;
+
+        /// Unmap and release OS handles (safe to call multiple times).
+        void close() noexcept;
+
+        /// Hint the OS that the mapping will be read front-to-back (aggressive read-ahead,
+        /// early page reclaim). No-op where unsupported.
+        void adviseSequential() const noexcept;
+
+        [[nodiscard]] const std::uint8_t *data() const noexcept { return data_; }
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool isOpen() const noexcept { return data_ != nullptr; }
+
+    private:
+        const std::uint8_t *data_ = nullptr;
+        std::size_t size_ = 0;
+
+#ifdef _WIN32
+        void *fileHandle_ = nullptr;
+        void *mappingHandle_ = nullptr;
+#endif
+    };
+
+} // namespace Core::IO
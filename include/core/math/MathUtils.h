@@ -2,8 +2,12 @@
 
 #include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <cmath>
+#include <vector>
 
 namespace Core
 {
@@ -86,5 +90,58 @@ namespace Core
             return glm::max(distX, distY);
         }
 
+        /**
+         * @brief View frustum as six normalized planes (xyz = inward normal, w = offset):
+         *        a point p is inside a plane when dot(xyz, p) + w >= 0.
+         */
+        struct Frustum
+        {
+            glm::vec4 planes[6]{}; // left, right, bottom, top, near, far
+        };
+
+        /**
+         * @brief Frustum of clip matrix @p clip, in the space @p clip maps from (world for
+         *        proj * view, mesh-local for proj * view * model). Depth uses Vulkan's
+         *        0 <= z <= w: glm::perspective emits the GL range, but the rasterizer clips
+         *        everything in front of z = 0.
+         */
+        [[nodiscard]] Frustum extractFrustum(const glm::mat4 &clip) noexcept;
+
+        /**
+         * @brief Boxes stored as separate center / half-extent arrays (structure of arrays),
+         *        so the culling kernel loads 4 (SSE) or 8 (AVX2) boxes per instruction.
+         */
+        struct AABBSoA
+        {
+            std::vector<float> cx, cy, cz; // centers
+            std::vector<float> ex, ey, ez; // half extents (>= 0)
+
+            [[nodiscard]] std::size_t size() const noexcept { return cx.size(); }
+
+            void resize(std::size_t n)
+            {
+                for (std::vector<float> *v : {&cx, &cy, &cz, &ex, &ey, &ez})
+                    v->resize(n);
+            }
+
+            void set(std::size_t i, const AABB &box) noexcept
+            {
+                const glm::vec3 c = 0.5f * (box.min + box.max);
+                const glm::vec3 e = 0.5f * (box.max - box.min);
+                cx[i] = c.x, cy[i] = c.y, cz[i] = c.z;
+                ex[i] = e.x, ey[i] = e.y, ez[i] = e.z;
+            }
+        };
+
+        /**
+         * @brief Frustum culling of many boxes: writes the indices of the boxes that are not
+         *        completely outside one of the planes to @p outIndices (room for boxes.size()),
+         *        in increasing order, and returns their count.
+         *
+         * Conservative: a box near a frustum corner may pass although it misses the
+         * frustum. Uses AVX2 when compiled with it (OME3D_ENABLE_AVX2), else SSE2 on x86-64.
+         */
+        std::size_t cullAABBs(const Frustum &frustum, const AABBSoA &boxes, uint32_t *outIndices) noexcept;
+
     } // namespace MathUtils
 } // namespace Core
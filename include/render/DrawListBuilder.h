@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "core/RadixSort.h"
+#include "core/math/MathUtils.h"
+#include "render/ObjectData.h"
+#include "rhi/vk/gfx/DrawItem.h"
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+namespace Vk::Gfx
+{
+    class StreamingIndexBuffer;
+}
+
+namespace Render
+{
+    class Camera;
+
+    struct LodSelectionSettings
+    {
+        // When off, every item draws LOD 0.
+        bool enabled = true;
+        // Largest acceptable projected simplification error, in pixels.
+        float pixelThreshold = 1.0f;
+        // Relative dead band around the threshold so items near a boundary don't flicker.
+        float hysteresis = 0.25f;
+    };
+
+    struct VisibilitySettings
+    {
+        // Per-item world bounds vs. view frustum; when off, every scene item is recorded.
+        bool frustum = true;
+    };
+
+    struct DrawOrderSettings
+    {
+        // Sort the built list by state (pipeline, material, mesh), then front to back; when off,
+        // visible items keep scene order.
+        bool sortByState = true;
+        // Merge consecutive items with the same mesh, material and LOD into one instanced draw.
+        bool instancing = true;
+    };
+
+    struct ClusterCullSettings
+    {
+        // When off, items draw their whole LOD range from the mesh's index buffer.
+        bool enabled = true;
+        // Per-meshlet bounding sphere vs. view frustum.
+        bool frustum = true;
+        // Per-meshlet normal cone vs. viewer (skipped for non-uniformly scaled or mirrored items).
+        bool normalCones = true;
+    };
+
+    /// Statistics of the last cluster culling pass.
+    struct ClusterCullStats
+    {
+        uint32_t itemsClustered = 0; // items drawn from the streaming index buffer
+        uint64_t clustersTested = 0;
+        uint64_t clustersVisible = 0;
+        uint64_t trianglesSubmitted = 0; // all items, after LOD selection and cluster culling
+        double cullMs = 0.0;             // CPU time of the pass, including the index copy
+    };
+
+    /// Statistics of the last built frame (visible items; triangles of the selected vs. the finest LODs).
+    struct DrawListStats
+    {
+        uint32_t items = 0;        // scene items
+        uint32_t itemsVisible = 0; // items passing the frustum test (the built list)
+        uint32_t itemsReduced = 0; // visible items drawn at a LOD coarser than 0
+        uint32_t draws = 0;        // entries of the built list (instanced groups count once)
+        uint64_t trianglesFull = 0;
+        uint64_t trianglesDrawn = 0;
+        double visibilityMs = 0.0; // CPU time of the frustum test (bounds refresh included)
+        double sortMs = 0.0;       // CPU time of building and sorting the draw order keys
+    };
+
+    /**
+     * @brief Turns the scene's static DrawItems into this frame's draw list.
+     *
+     * - Items whose world AABB lies outside the camera frustum are dropped
+     *   (Core::MathUtils::cullAABBs over SoA bounds). The bounds and each item's
+     *   ObjectData (model + normal matrix) are computed once per scene list and rebuilt
+     *   when its storage or size changes; transforms are static.
+     * - Per visible item, picks the coarsest LOD whose error, projected to the screen at the
+     *   item's bounding-sphere distance, stays under LodSelectionSettings::pixelThreshold.
+     * - The LOD chosen last frame is kept unless the new one clears the threshold by
+     *   the hysteresis margin (coarser) or the current one exceeds it by that margin (finer).
+     * - Per-item LOD state is indexed by position in the scene list and is reset when
+     *   the list size changes.
+     * - The visible items are then ordered by a 64-bit key, radix sorted:
+     *   [63:62] pipeline | material | mesh | squared view distance (high bits),
+     *   so the recorder rebinds a material or a geometry page only between runs and opaque
+     *   draws within a run go front to back. Material and mesh ids are dense per scene list
+     *   (meshes numbered by geometry page) and get just enough bits to never alias; depth
+     *   keeps up to 32 of the remaining bits.
+     * - Runs of consecutive items with the same mesh, material and LOD then collapse into
+     *   one item drawing instanceCount object buffer entries (DrawItem::firstInstance).
+     *   Instanced items are left out of cluster culling: their meshlets are drawn in full.
+     *
+     * cullClusters() then refines the list for one swapchain image: items drawn at LOD 0
+     * whose mesh has meshlets keep only the clusters that survive the frustum and normal cone
+     * tests, and their indices are copied into that image's slot of a streaming index buffer
+     * (items that lose no cluster keep drawing from their own index buffer).
+     * It uses the camera passed to the preceding build().
+     *
+     * The result is re-recorded into the scene command buffer every frame.
+     */
+    class DrawListBuilder
+    {
+    public:
+        /**
+         * @brief Build this frame's list from @p sceneItems.
+         * @param sceneGeneration Scene::generation() of @p sceneItems: world bounds, object data and
+         *                        state keys are cached per item and recomputed when it changes
+         *                        (or when the list is a different vector / size).
+         */
+        const std::vector<Vk::Gfx::DrawItem> &build(const std::vector<Vk::Gfx::DrawItem> &sceneItems,
+                                                    const Camera &camera,
+                                                    float viewportHeight,
+                                                    uint64_t sceneGeneration = 0);
+
+        /// Drop the per-item caches; for callers that edit DrawItem fields in place without a generation.
+        void invalidate() noexcept { boundsSource_ = nullptr; }
+
+        /**
+         * @brief ObjectData (model + normal matrix) of every item of @p sceneItems, by scene index:
+         *        the per-item cache build() uses, refreshed first. Shared with the GPU-driven pass
+         *        so both paths upload the same matrices.
+         */
+        const std::vector<ObjectData> &sceneObjects(const std::vector<Vk::Gfx::DrawItem> &sceneItems,
+                                                    uint64_t sceneGeneration = 0);
+
+        /**
+         * @brief Cull meshlets of the built list and stream the visible indices into @p out.
+         * @param out   Streaming index buffer; slot @p slot must no longer be in use by the GPU
+         * @param slot  Swapchain image index about to be recorded
+         */
+        void cullClusters(Vk::Gfx::StreamingIndexBuffer &out, uint32_t slot);
+
+        [[nodiscard]] const std::vector<Vk::Gfx::DrawItem> &items() const noexcept { return items_; }
+        /// Object buffer entries of the visible items; items() address them by firstInstance / instanceCount.
+        [[nodiscard]] const std::vector<ObjectData> &objects() const noexcept { return objects_; }
+        [[nodiscard]] const DrawListStats &stats() const noexcept { return stats_; }
+        [[nodiscard]] const ClusterCullStats &clusterStats() const noexcept { return clusterStats_; }
+
+        [[nodiscard]] VisibilitySettings &visibilitySettings() noexcept { return visibilitySettings_; }
+        [[nodiscard]] const VisibilitySettings &visibilitySettings() const noexcept { return visibilitySettings_; }
+
+        [[nodiscard]] LodSelectionSettings &lodSettings() noexcept { return lodSettings_; }
+        [[nodiscard]] const LodSelectionSettings &lodSettings() const noexcept { return lodSettings_; }
+
+        [[nodiscard]] DrawOrderSettings &drawOrderSettings() noexcept { return drawOrderSettings_; }
+        [[nodiscard]] const DrawOrderSettings &drawOrderSettings() const noexcept { return drawOrderSettings_; }
+
+        [[nodiscard]] ClusterCullSettings &clusterSettings() noexcept { return clusterSettings_; }
+        [[nodiscard]] const ClusterCullSettings &clusterSettings() const noexcept { return clusterSettings_; }
+
+    private:
+        /// Rebuild worldBounds_ / sceneObjects_ / sceneStateKeys_ unless they were computed for this list and generation.
+        void refreshBounds(const std::vector<Vk::Gfx::DrawItem> &sceneItems, uint64_t sceneGeneration);
+
+        VisibilitySettings visibilitySettings_{};
+        LodSelectionSettings lodSettings_{};
+        DrawOrderSettings drawOrderSettings_{};
+        ClusterCullSettings clusterSettings_{};
+        DrawListStats stats_{};
+        ClusterCullStats clusterStats_{};
+
+        // Camera of the last build(), consumed by cullClusters()
+        glm::mat4 viewProj_{1.0f};
+        glm::vec3 eye_{0.0f};
+
+        std::vector<uint32_t> visibleMeshlets_; // scratch: surviving meshlet ids, item after item
+        std::vector<uint32_t> visibleEnd_;      // scratch: per item, end of its ids in visibleMeshlets_
+
+        // World AABBs of the scene items (SoA), valid for boundsSource_ / boundsCount_ / boundsGeneration_
+        Core::MathUtils::AABBSoA worldBounds_;
+        std::vector<ObjectData> sceneObjects_;
+        std::vector<uint64_t> sceneStateKeys_; // sort key without depth (pipeline | material | mesh)
+        uint32_t depthBits_ = 32;              // low bits of the sort key left for depth
+        const Vk::Gfx::DrawItem *boundsSource_ = nullptr;
+        std::size_t boundsCount_ = 0;
+        uint64_t boundsGeneration_ = 0;
+        std::vector<uint32_t> visibleItems_; // scratch: scene indices passing the frustum test
+
+        std::vector<Vk::Gfx::DrawItem> items_;
+        std::vector<ObjectData> objects_;
+        std::vector<uint32_t> currentLod_; // per scene item, persists across frames
+
+        // Draw order scratch
+        std::vector<Core::SortEntry> sortEntries_;
+        std::vector<Core::SortEntry> sortScratch_;
+        std::vector<Vk::Gfx::DrawItem> sortedItems_;
+        std::vector<ObjectData> sortedObjects_;
+    };
+
+} // namespace Render
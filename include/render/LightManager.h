@@ -26,7 +26,8 @@ namespace Render
         void destroy();
 
         // Upload GPU arrays to GPUbuffers + update UBO counts/ambient/flags
-        void upload(VkCommandPool cmdPool, VkQueue queue,
+        // SSBO copies are recorded into @p upload; flush it before the next frame reads them
+        void upload(Vk::UploadContext &upload,
                     const glm::vec3 &ambientRGB,
                     uint32_t flags);
 
@@ -0,0 +1,16 @@
+// include/render/ObjectData.h
+#pragma once
+#include <glm/mat4x4.hpp>
+
+namespace Render
+{
+    /// One draw's entry in the per-frame object buffer (vert.glsl: ObjectBuffer, std430).
+    struct alignas(16) ObjectData
+    {
+        glm::mat4 model;
+        glm::mat4 normalMatrix; // inverse-transpose of the upper 3x3 (mat4: std430 pads mat3 columns anyway)
+    };
+
+    static_assert(sizeof(ObjectData) == 128, "must match vert.glsl ObjectData");
+
+} // namespace Render
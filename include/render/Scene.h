@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <string>
+#include <filesystem>
 
 #include <glm/mat4x4.hpp>
 #include <vulkan/vulkan.h>
@@ -13,6 +15,7 @@
 #include "render/materials/MaterialSystem.h"
 #include "asset/io/GltfLoader.h"
 #include "asset/processing/MeshOptimize.h"
+#include "asset/cache/MeshCache.h"
 #include "core/math/MathUtils.h"
 
 namespace Render
@@ -38,30 +41,45 @@ namespace Render
          * @brief Load a glTF model from disk, optimize meshes, upload meshes to GPU,
          *        and create materials for them.
          *
+         * Processed meshes are cached on disk keyed by source content + settings;
+         * a warm start maps the cache file and skips import/optimization entirely.
+         *
          * @param gltfPath   Path to .gltf or .glb
-         * @param allocator  VMA allocator
-         * @param device     VkDevice for buffer creation / descriptor updates
-         * @param cmdPool    Command pool used for one-time staging copies
-         * @param queue      Queue used to submit staging copies
+         * @param upload     Upload batch the mesh and texture copies are recorded into
+         *                   (flushed by the caller before the first frame)
+         * @param geometry   Arena the mesh ranges are suballocated from (must outlive the Scene)
          * @param materialSystem MaterialSystem (already initialized)
          *
          * This fills internal gpuMeshes_, drawItems_, and worldAabb_.
          */
         void loadModel(const std::string &gltfPath,
-                       VmaAllocator allocator,
-                       VkDevice device,
-                       VkCommandPool cmdPool,
-                       VkQueue queue,
+                       Vk::UploadContext &upload,
+                       Vk::Gfx::GeometryArena &geometry,
                        MaterialSystem &materialSystem);
 
+        /**
+         * @brief Directory for the processed-mesh cache (see Asset::MeshCache).
+         *        An empty path disables the cache. Default: "cache/meshes".
+         */
+        void setMeshCacheDirectory(std::filesystem::path dir) { meshCacheDir_ = std::move(dir); }
+
         /// Draw list for rendering (stable non-owning pointers).
         const std::vector<Vk::Gfx::DrawItem> &drawItems() const noexcept { return drawItems_; }
 
+        /**
+         * @brief Move draw item @p index to @p transform (local -> world).
+         *        Bumps generation(), so per-item caches rebuild on their next use.
+         */
+        void setTransform(std::size_t index, const glm::mat4 &transform);
+
+        /// Changes whenever drawItems() is rebuilt or edited; caches of per-item data key on it.
+        [[nodiscard]] uint64_t generation() const noexcept { return generation_; }
+
         /// World-space bounding box of all meshes (for camera framing).
         const Core::MathUtils::AABB &worldBounds() const noexcept { return worldAaBb_; }
 
     protected:
-        // All GPU meshes owned by the Scene
+        // All GPU meshes owned by the Scene (one per unique geometry; instances live in drawItems_)
         std::vector<std::unique_ptr<Vk::Gfx::Mesh>> gpuMeshes_;
 
         // Materials owned by the Scene
@@ -72,6 +90,12 @@ namespace Render
 
         // Cached world bounds of the whole scene
         Core::MathUtils::AABB worldAaBb_{};
+
+        // Bumped by every change to drawItems_ (see generation())
+        uint64_t generation_ = 0;
+
+        // Where loadModel() keeps processed meshes between runs
+        std::filesystem::path meshCacheDir_{"cache/meshes"};
     };
 
 } // namespace Render
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "render/Scene.h"
+
+#include <cstdint>
+
+// Many copies of two small procedural meshes (a bolt and a nut) sharing one material,
+// laid out on a grid. Used to measure per-draw CPU cost: compare draw calls and frame
+// time in the Stats/Rendering panels with DrawOrderSettings::instancing on and off.
+// Enabled with "stressSceneObjects = N" in engine.cfg.
+namespace Render
+{
+    class StressScene final : public Scene
+    {
+    public:
+        // Upload both meshes once and register @p objectCount DrawItems (every 4th one a nut).
+        // Copies are recorded into @p upload; flush it before the first frame.
+        void build(Vk::UploadContext &upload,
+                   Vk::Gfx::GeometryArena &geometry,
+                   MaterialSystem &materialSystem,
+                   uint32_t objectCount);
+
+    private:
+        // Append a closed prism around +Y: @p sides flat faces of radius @p radius, from y0 to y1.
+        static void appendPrism(uint32_t sides, float radius, float y0, float y1,
+                                std::vector<Vk::Gfx::Vertex> &verts,
+                                std::vector<uint32_t> &idx);
+    };
+}
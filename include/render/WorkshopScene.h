@@ -13,13 +13,12 @@ namespace Render
     {
     public:
         // Build the scene into GPU using your existing upload path:
-        // - allocates vertex/index buffers with VMA via Vk::Gfx::Mesh
+        // - suballocates vertex/index ranges from @p geometry via Vk::Gfx::Mesh
         // - registers DrawItems (mesh + material) inside Scene
         // - computes world AABB for camera framing
-        void build(VmaAllocator allocator,
-                   VkDevice device,
-                   VkCommandPool cmdPool,
-                   VkQueue queue,
+        // Copies are recorded into @p upload; flush it before the first frame.
+        void build(Vk::UploadContext &upload,
+                   Vk::Gfx::GeometryArena &geometry,
                    MaterialSystem &materialSystem);
 
     private:
@@ -5,7 +5,15 @@
 #include <memory>
 #include <string>
 
+#include "rhi/vk/gfx/SamplerCache.h"
 #include "rhi/vk/gfx/Texture2D.h"
+#include "render/materials/TextureCache.h"
+
+namespace Asset
+{
+    class ImageDecodeBatch;
+    class TextureCookCache;
+}
 
 #include <vk_mem_alloc.h>
 #include <glm/glm.hpp>
@@ -54,7 +62,26 @@ namespace Render
     };
 
     /**
-     * @brief Owns textures + tiny UBO and a ready-to-bind descriptor set (set = 1).
+     * @brief Offline texture cooking: mips built on the CPU and block-compressed, cached on disk.
+     *
+     * Slots are stored as BC7 (base color / emissive in sRGB, ARM), BC5 (normals,
+     * MR) and BC4 (AO). Without BC support the cooked chains keep the slots' plain
+     * formats (RGBA8 / RG8 / R8) but still skip the GPU mip blits.
+     * Disabled while cache is null.
+     */
+    struct TextureCooking
+    {
+        Asset::TextureCookCache *cache = nullptr;
+        bool blockCompression = false; ///< device samples BC4/BC5/BC7 (VulkanLogicalDevice::supportsBlockCompression)
+
+        // Counters since construction
+        uint64_t loaded = 0;  ///< textures read from cooked files
+        uint64_t cooked = 0;  ///< textures cooked (and stored) on a miss
+        double cookMs = 0.0;  ///< time spent cooking
+    };
+
+    /**
+     * @brief Holds textures (shared through a TextureCache) + tiny UBO and a ready-to-bind descriptor set (set = 1).
      *
      * TEMPORARY: This class allocates descriptor sets directly from a pool passed in
      * by MaterialSystem. In the future we may want a central allocator or bindless.
@@ -68,20 +95,42 @@ namespace Render
         Material(const Material &) = delete;
         Material &operator=(const Material &) = delete;
 
+        /// Queue every image file @p desc references (except maps already in @p cache),
+        /// at the channel count create() will look up.
+        /// Maps with a cooked entry on disk are skipped too.
+        static void requestImages(const MaterialDesc &desc, Asset::ImageDecodeBatch &batch,
+                                  const TextureCache *cache = nullptr,
+                                  const TextureCooking *cooking = nullptr);
+
+        /**
+         * @brief Record texture uploads and write the descriptor set.
+         * @param samplers Shared samplers; every texture this material creates gets one from it.
+         * @param decoded Images already decoded for @p desc (see requestImages()); when null
+         *                they are decoded here, on the calling thread.
+         * @param cache   Shared textures (hits skip the upload); when null the textures are private.
+         * @param cooking Load / cook textures through a TextureCookCache; when null they are uploaded
+         *                in their plain formats with GPU-generated mips.
+         */
         void create(VmaAllocator allocator, VkDevice dev,
                     VkDescriptorPool pool, VkDescriptorSetLayout layout,
-                    VkCommandPool uploadPool,
-                    VkQueue uploadQueue,
+                    Vk::UploadContext &upload,
+                    Vk::Gfx::SamplerCache &samplers,
                     const MaterialDesc &desc,
                     // fallback textures (not owned)
                     Vk::Gfx::Texture2D *white,
                     Vk::Gfx::Texture2D *flatNormal,
-                    Vk::Gfx::Texture2D *black);
+                    Vk::Gfx::Texture2D *black,
+                    const Asset::ImageDecodeBatch *decoded = nullptr,
+                    TextureCache *cache = nullptr,
+                    TextureCooking *cooking = nullptr);
 
         void destroy() noexcept;
 
         VkDescriptorSet descriptorSet() const noexcept { return set_; }
 
+        /// GPU bytes of the textures this material binds (shared ones counted in full, fallbacks not at all).
+        [[nodiscard]] uint64_t textureBytes() const noexcept;
+
     private:
         void createUbo();
         void updateUbo(const MaterialParams &p);
@@ -95,12 +144,12 @@ namespace Render
         VmaAllocation uboAlloc_{VK_NULL_HANDLE};
         VkDescriptorSet set_{VK_NULL_HANDLE};
 
-        // Owned textures (may be nullptr if we used fallbacks)
-        std::unique_ptr<Vk::Gfx::Texture2D> baseColor_;
-        std::unique_ptr<Vk::Gfx::Texture2D> normal_;
-        std::unique_ptr<Vk::Gfx::Texture2D> mr_;
-        std::unique_ptr<Vk::Gfx::Texture2D> occlusion_;
-        std::unique_ptr<Vk::Gfx::Texture2D> emissive_;
+        // Textures, possibly shared with other materials through the TextureCache (nullptr if we used fallbacks)
+        std::shared_ptr<Vk::Gfx::Texture2D> baseColor_;
+        std::shared_ptr<Vk::Gfx::Texture2D> normal_;
+        std::shared_ptr<Vk::Gfx::Texture2D> mr_;
+        std::shared_ptr<Vk::Gfx::Texture2D> occlusion_;
+        std::shared_ptr<Vk::Gfx::Texture2D> emissive_;
 
         // Bound texture views/samplers (either owned textures or fallbacks)
         VkImageView albedoView_{VK_NULL_HANDLE};
@@ -2,9 +2,17 @@
 
 #include <vulkan/vulkan.h>
 
+#include <filesystem>
+#include <map>
 #include <memory>
+#include <span>
+#include <string>
+#include <vector>
 
 #include "Material.h"
+#include "TextureCache.h"
+#include "asset/cache/TextureCookCache.h"
+#include "rhi/vk/gfx/SamplerCache.h"
 #include "rhi/vk/gfx/Texture2D.h"
 
 #include <vk_mem_alloc.h>
@@ -14,9 +22,14 @@ namespace Render
 
     /**
      * @brief TEMPORARY material hub: owns descriptor pool, layout (must match pipeline set=1),
-     * and fallback textures. Creates Material instances on demand.
+     * fallback textures and the samplers every texture shares (SamplerCache). Creates Material instances on demand.
      *
-     * Later we can move to a dedicated module, add caching and async loading.
+     * Sharing: textures go through a TextureCache (path + format + mips, optionally
+     * content-hashed), and a MaterialDesc identical to one whose Material is still
+     * alive returns that Material instead of a copy.
+     *
+     * Cooking (optional): textures are mip-mapped and block-compressed once on the
+     * CPU and kept in a TextureCookCache; later loads copy the finished chain.
      */
     class MaterialSystem
     {
@@ -24,14 +37,36 @@ namespace Render
         MaterialSystem() = default;
         ~MaterialSystem() { shutdown(); }
 
+        /// @param maxAnisotropy Device limit (VkPhysicalDeviceLimits::maxSamplerAnisotropy) the shared samplers clamp to.
         void init(VmaAllocator allocator, VkDevice dev,
                   VkDescriptorSetLayout materialLayout,
-                  uint32_t maxMaterials);
+                  uint32_t maxMaterials,
+                  float maxAnisotropy);
 
         void shutdown() noexcept;
 
         std::shared_ptr<Material> createMaterial(const MaterialDesc &desc);
 
+        /**
+         * @brief Create several materials at once: every image they reference is decoded
+         *        concurrently on worker threads first (shared files once), then the uploads
+         *        are recorded on the calling thread. Result order matches @p descs.
+         */
+        std::vector<std::shared_ptr<Material>> createMaterials(std::span<const MaterialDesc> descs);
+
+        /// Texture/material/sampler cache counters + resident bytes (memory panel).
+        [[nodiscard]] TextureCacheStats cacheStats() const;
+
+        /// Alias textures whose pixels match a resident one under another path (hashes every uploaded map).
+        void setContentHashing(bool enabled) noexcept { textures_.setContentHashing(enabled); }
+
+        /**
+         * @brief Load textures from cooked files in @p directory (mips + BC7/BC5/BC4 when
+         *        @p blockCompression, else RGBA8 mips), cooking them on first use.
+         *        An empty path disables cooking (RGBA8 uploads with GPU mips).
+         */
+        void setTextureCooking(const std::filesystem::path &directory, bool blockCompression);
+
         // Fallbacks (non-owning accessors)
         Vk::Gfx::Texture2D *white() const { return white_.get(); }
         Vk::Gfx::Texture2D *black() const { return black_.get(); }
@@ -40,13 +75,16 @@ namespace Render
         VkDescriptorPool pool() const { return pool_; }
         VkDescriptorSetLayout layout() const { return layout_; }
 
-        // TEMPORARY: expose cmd resources if needed by Texture2D
-        void setUploadCmd(VkCommandPool pool, VkQueue queue);
+        /// Upload batch that texture copies are recorded into (must be set before init()).
+        void setUploadContext(Vk::UploadContext &upload) { upload_ = &upload; }
 
     private:
         void createFallbacks();
         void destroyFallbacks();
 
+        /// Byte-exact identity of a desc (paths + params) for material sharing.
+        static std::string descKey(const MaterialDesc &desc);
+
     private:
         VmaAllocator allocator_{VK_NULL_HANDLE};
         VkDevice device_{VK_NULL_HANDLE};
@@ -54,9 +92,17 @@ namespace Render
         VkDescriptorPool pool_{VK_NULL_HANDLE};
         VkDescriptorSetLayout layout_{VK_NULL_HANDLE}; // same object as in pipeline (we don't create it here)
 
-        // Upload helpers (TEMP): used if Texture2D path loaders need them
-        VkCommandPool uploadPool_{VK_NULL_HANDLE};
-        VkQueue uploadQueue_{VK_NULL_HANDLE};
+        // Not owned; the renderer flushes it before materials are sampled
+        Vk::UploadContext *upload_{nullptr};
+
+        // Sharing (weak: materials/textures die with their last user)
+        Vk::Gfx::SamplerCache samplers_; // strong: lives until shutdown()
+        TextureCache textures_;
+        std::unique_ptr<Asset::TextureCookCache> cookCache_;
+        TextureCooking cooking_;
+        std::map<std::string, std::weak_ptr<Material>> materialsByDesc_;
+        uint64_t materialLookups_{0};
+        uint64_t materialHits_{0};
 
         // 1×1 fallback textures
         std::unique_ptr<Vk::Gfx::Texture2D> white_;
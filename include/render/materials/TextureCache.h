@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "rhi/vk/gfx/Texture2D.h"
+
+namespace Render
+{
+
+    /// Identifies one GPU texture: its source (a file path, or a description of packed inputs) + upload settings.
+    struct TextureKey
+    {
+        std::string source;
+        VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+        bool mips = true;
+        VkComponentMapping swizzle{}; ///< view mapping (identity by default)
+
+        bool operator<(const TextureKey &o) const
+        {
+            return std::tie(source, format, mips, swizzle.r, swizzle.g, swizzle.b, swizzle.a) <
+                   std::tie(o.source, o.format, o.mips, o.swizzle.r, o.swizzle.g, o.swizzle.b, o.swizzle.a);
+        }
+    };
+
+    /// Counters since construction (shown in the memory panel).
+    struct TextureCacheStats
+    {
+        uint64_t lookups = 0;       ///< acquire() calls
+        uint64_t pathHits = 0;      ///< served by key (no decode, no upload)
+        uint64_t contentHits = 0;   ///< new key, but identical pixels already resident (no upload)
+        uint64_t uploads = 0;       ///< textures created through the cache
+        uint64_t bytesSaved = 0;    ///< GPU bytes (all mips) not allocated thanks to hits
+        uint64_t bytesResident = 0; ///< GPU bytes of live cached textures (each counted once)
+        uint32_t liveTextures = 0;
+
+        uint64_t materialLookups = 0; ///< MaterialSystem: materials requested
+        uint64_t materialHits = 0;    ///< ... served by an identical, still alive Material
+
+        uint64_t cookedLoads = 0; ///< MaterialSystem: textures read from cooked files (no decode, no blits)
+        uint64_t cooked = 0;      ///< ... cooked on a miss and written to the disk cache
+        double cookMs = 0.0;      ///< ... time spent cooking
+
+        uint32_t uniqueSamplers = 0;  ///< MaterialSystem: VkSamplers alive (one per distinct state)
+        uint64_t samplerRequests = 0; ///< ... textures/materials that asked for one
+    };
+
+    /**
+     * @brief Shares textures between materials.
+     *
+     * Entries hold weak references: a texture lives as long as some Material owns
+     * it, and the cache never keeps GPU memory alive on its own.
+     *
+     * Lookups by key skip both decode and upload. With content hashing enabled, a
+     * miss whose pixels hash like a resident texture of the same format aliases
+     * that texture instead of uploading a duplicate (same image under another path).
+     *
+     * Each entry carries a small caller-defined tag (e.g. "AO was packed into this MR map"),
+     * so a hit can restore decisions made when the texture was built.
+     */
+    class TextureCache
+    {
+    public:
+        /// Cached texture for @p key (counts a lookup); null on a miss or when it was released.
+        std::shared_ptr<Vk::Gfx::Texture2D> acquire(const TextureKey &key, uint32_t *tag = nullptr);
+
+        /// Like acquire() without touching the counters (used to plan decoding).
+        [[nodiscard]] bool contains(const TextureKey &key, uint32_t *tag = nullptr) const;
+
+        /**
+         * @brief Resident texture with identical pixels (same format/mips/swizzle), aliased under @p key.
+         *        Null when hashing is off, @p contentHash is 0 or nothing matches.
+         */
+        std::shared_ptr<Vk::Gfx::Texture2D> acquireByContent(const TextureKey &key, uint64_t contentHash, uint32_t tag);
+
+        /// Register a freshly uploaded texture.
+        void insert(const TextureKey &key, uint64_t contentHash, uint32_t tag,
+                    const std::shared_ptr<Vk::Gfx::Texture2D> &texture);
+
+        /// Hash of tightly packed pixels + dimensions (0 when hashing is disabled).
+        [[nodiscard]] uint64_t hashPixels(const void *pixels, std::size_t bytes, uint32_t width, uint32_t height) const;
+
+        void setContentHashing(bool enabled) noexcept { contentHashing_ = enabled; }
+        [[nodiscard]] bool contentHashing() const noexcept { return contentHashing_; }
+
+        /// Drop entries whose texture was released.
+        void prune();
+
+        /// Counters + resident totals (material and cooking fields are filled in by MaterialSystem).
+        [[nodiscard]] TextureCacheStats stats() const;
+
+    private:
+        struct Entry
+        {
+            std::weak_ptr<Vk::Gfx::Texture2D> texture;
+            uint64_t contentHash = 0;
+            uint32_t tag = 0;
+        };
+
+        /// Resident content: hash -> any key holding it.
+        struct ContentKey
+        {
+            uint64_t hash;
+            VkFormat format;
+            bool mips;
+            VkComponentMapping swizzle;
+
+            bool operator<(const ContentKey &o) const
+            {
+                return std::tie(hash, format, mips, swizzle.r, swizzle.g, swizzle.b, swizzle.a) <
+                       std::tie(o.hash, o.format, o.mips, o.swizzle.r, o.swizzle.g, o.swizzle.b, o.swizzle.a);
+            }
+        };
+
+        std::map<TextureKey, Entry> entries_;
+        std::map<ContentKey, TextureKey> byContent_;
+        bool contentHashing_ = true;
+        TextureCacheStats stats_{};
+    };
+
+} // namespace Render
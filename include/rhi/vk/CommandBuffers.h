@@ -30,19 +30,40 @@ namespace Vk
     class SwapChain;
     class ImageViews;
     class DepthResources;
+    class GpuDrivenPass;
 
     namespace Gfx
     {
         struct DrawItem;
     }
 
+    /// Counters of the last scene recording (see CommandBuffers::recordStats()).
+    struct RecordStats
+    {
+        uint32_t draws = 0;
+        uint32_t instances = 0;         ///< objects drawn (> draws when items were instanced)
+        uint32_t indirectDraws = 0;     ///< vkCmdDrawIndexedIndirectCount calls (GPU-driven path; counts live on the GPU)
+        uint32_t vertexBufferBinds = 0; ///< only when the geometry arena page changes
+        uint32_t indexBufferBinds = 0;  ///< page change or switch to/from the cluster index stream
+        uint32_t descriptorSetBinds = 0; ///< view + lighting once, then one per material change
+        double cpuMs = 0.0; ///< begin -> end of the scene command buffer
+    };
+
     /**
      * @brief Owns one primary command buffer per swapchain image and records a simple draw list.
      *
      * Recording policy:
      *   - per-frame UBO (Render::ViewUniforms) is expected to be already bound externally
      *     via descriptor sets (set/binding defined in your pipeline layout);
-     *   - per-object data (model matrix) is pushed as push-constants (64 bytes).
+     *   - per-object data (model + normal matrix) is not pushed: an item draws entries
+     *     [firstInstance, firstInstance + instanceCount) of the image's object buffer
+     *     (set=0, binding=1) as one instanced draw;
+     *   - bound state is tracked across the list: the material set (set=1) and the
+     *     vertex/index buffers are rebound only when they differ from the previous draw
+     *     (GeometryArena pages, the cluster index stream), so a list sorted by material
+     *     and mesh (Render::DrawListBuilder) binds once per run; draws differ by offsets.
+     *   - with a GpuDrivenPass, the item list is ignored: the pass culls on the GPU before
+     *     rendering and draws the scene with one indirect-count draw per batch.
      */
     class CommandBuffers
     {
@@ -53,10 +74,14 @@ namespace Vk
         CommandBuffers(const CommandBuffers &) = delete;
         CommandBuffers &operator=(const CommandBuffers &) = delete;
 
-        /// Record commands for a particular swapchain image index.
-        // Now binds *two* descriptor sets:
-        //   set=0 : view (UBO per image)
-        //   set=1 : material (albedo sampler) -- TEMPORARY single set reused for all draws
+        /// Record commands for a particular swapchain image index (called each frame with that frame's draw list).
+        // Descriptor sets:
+        //   set=0 : view (UBO + object buffer per image), bound once
+        //   set=1 : material, bound when it changes between consecutive items
+        //   set=2 : lighting (optional), bound once
+        // Items flagged DrawItem::clustered take their indices from clusterIndexBuffer.
+        // The object buffer behind viewSet must hold the entries the items' instance ranges address.
+        // A ready gpuDriven pass replaces items/viewSet with its own culled indirect draws.
         void record(uint32_t imageIndex,
                     const GraphicsPipeline &pipeline,
                     const SwapChain &swapchain,
@@ -64,7 +89,9 @@ namespace Vk
                     const DepthResources &depth,
                     const std::vector<Gfx::DrawItem> &items,
                     VkDescriptorSet viewSet,
-                    VkDescriptorSet lightingSet);
+                    VkDescriptorSet lightingSet,
+                    VkBuffer clusterIndexBuffer = VK_NULL_HANDLE,
+                    GpuDrivenPass *gpuDriven = nullptr);
 
         // record only ImGui draw commands for given image index (called each frame)
         void recordImGuiForImage(uint32_t imageIndex,
@@ -73,14 +100,18 @@ namespace Vk
                                  const DepthResources &depth,
                                  UI::ImGuiLayer &imguiLayer);
 
+        /// Bind/draw counters and CPU time of the most recent record().
+        [[nodiscard]] const RecordStats &recordStats() const noexcept { return recordStats_; }
+
         // Accessors (add to public API)
         VkCommandBuffer sceneCommand(uint32_t imageIndex) const { return sceneBuffers_.at(imageIndex); }
         VkCommandBuffer uiCommand(uint32_t imageIndex) const { return uiBuffers_.at(imageIndex); }
 
     private:
         VkDevice device_{};
-        std::vector<VkCommandBuffer> sceneBuffers_; // pre-recorded scene commands (one per image)
+        std::vector<VkCommandBuffer> sceneBuffers_; // per-frame scene commands (one per image)
         std::vector<VkCommandBuffer> uiBuffers_;    // per-frame ImGui commands (one per image)
+        RecordStats recordStats_{};
 
         void allocate(const CommandPool &pool, std::size_t count);
     };
@@ -2,9 +2,12 @@
 #include <vulkan/vulkan.h>
 #include "core/Logger.h"
 
-#include <stdexcept>
-#include <sstream>
+#include <fstream>
 #include <initializer_list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 // -------- Result → string ----------
 inline const char *VkResultToString(VkResult r)
@@ -80,6 +83,21 @@ inline const char *VkResultToString(VkResult r)
     }
 }
 
+// ---------- files ----------
+// Whole file as bytes (SPIR-V modules); throws std::runtime_error if it can't be opened.
+inline std::vector<char> readBinaryFile(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::ate | std::ios::binary);
+    if (!file.is_open())
+        throw std::runtime_error("Failed to open file " + filename);
+
+    const size_t fileSize = static_cast<size_t>(file.tellg());
+    std::vector<char> buffer(fileSize);
+    file.seekg(0);
+    file.read(buffer.data(), fileSize);
+    return buffer;
+}
+
 // ---------- helpers ----------
 inline bool vk_is_allowed(VkResult r, std::initializer_list<VkResult> ok)
 {
@@ -2,26 +2,38 @@
 
 #include <vulkan/vulkan.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 #include "core/Logger.h"
 #include "rhi/vk/Common.h"
 
+#include "render/ObjectData.h"   // CPU-side object buffer entry
 #include "render/ViewUniforms.h" // CPU-side UBO layout
 
 namespace Vk
 {
 
     /**
-     * Per-swapchain-image resources: UBO buffer + memory + descriptor set.
+     * Per-swapchain-image resources: UBO buffer + memory + descriptor set, and the
+     * object buffer (set = 0, binding 1) the vertex shader reads model/normal matrices from.
      * Owned by RendererContext (or FrameResourcesManager).
      */
     struct FrameResources
     {
+        /// Object buffer capacity of a new image (grows by doubling).
+        static constexpr uint32_t kInitialObjects = 1024;
+
         VkBuffer viewUbo = VK_NULL_HANDLE;
         VkDeviceMemory viewUboMem = VK_NULL_HANDLE;
         VkDescriptorSet viewSet = VK_NULL_HANDLE;
 
+        VkBuffer objectBuffer = VK_NULL_HANDLE;
+        VkDeviceMemory objectMem = VK_NULL_HANDLE;
+        void *objectMapped = nullptr; // persistently mapped (HOST_COHERENT)
+        uint32_t objectCapacity = 0;
+
         // Create per-image resources:
         // - create buffer (HOST_VISIBLE | HOST_COHERENT)
         // - allocate descriptor set from provided pool using viewSetLayout
@@ -78,6 +90,24 @@ namespace Vk
             w.pBufferInfo = &bufInfo;
 
             vkUpdateDescriptorSets(device, 1, &w, 0, nullptr);
+
+            createObjectBuffer(phys, device, kInitialObjects);
+        }
+
+        // Copy this frame's object entries (index = position in the draw list). Only call once the
+        // image's previous submission has completed: a larger buffer replaces the old one in place.
+        void updateObjects(VkPhysicalDevice phys, VkDevice device, const Render::ObjectData *objects, size_t count)
+        {
+            if (count > objectCapacity)
+            {
+                uint32_t capacity = std::max(objectCapacity, kInitialObjects);
+                while (capacity < count)
+                    capacity *= 2;
+                destroyObjectBuffer(device);
+                createObjectBuffer(phys, device, capacity);
+            }
+            if (count > 0)
+                std::memcpy(objectMapped, objects, count * sizeof(Render::ObjectData));
         }
 
         // update UBO with host-visible memory
@@ -91,6 +121,7 @@ namespace Vk
 
         void destroy(VkDevice device) noexcept
         {
+            destroyObjectBuffer(device);
             if (viewSet != VK_NULL_HANDLE)
                 viewSet = VK_NULL_HANDLE; // freed with pool
             if (viewUbo)
@@ -106,6 +137,64 @@ namespace Vk
         }
 
     private:
+        // Storage buffer for @p capacity entries, mapped, written to binding 1 of viewSet
+        void createObjectBuffer(VkPhysicalDevice phys, VkDevice device, uint32_t capacity)
+        {
+            VkBufferCreateInfo bi{VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+            bi.size = VkDeviceSize(capacity) * sizeof(Render::ObjectData);
+            bi.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+            bi.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+            VK_CHECK(vkCreateBuffer(device, &bi, nullptr, &objectBuffer));
+
+            VkMemoryRequirements req{};
+            vkGetBufferMemoryRequirements(device, objectBuffer, &req);
+
+            VkMemoryAllocateInfo ai{VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+            ai.allocationSize = req.size;
+            ai.memoryTypeIndex = findMemoryTypeIndex(phys, req.memoryTypeBits,
+                                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+            VK_CHECK(vkAllocateMemory(device, &ai, nullptr, &objectMem));
+            VK_CHECK(vkBindBufferMemory(device, objectBuffer, objectMem, 0));
+            VK_CHECK(vkMapMemory(device, objectMem, 0, VK_WHOLE_SIZE, 0, &objectMapped));
+            objectCapacity = capacity;
+
+            VkDescriptorBufferInfo bufInfo{};
+            bufInfo.buffer = objectBuffer;
+            bufInfo.offset = 0;
+            bufInfo.range = VK_WHOLE_SIZE;
+
+            VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+            w.dstSet = viewSet;
+            w.dstBinding = 1;
+            w.dstArrayElement = 0;
+            w.descriptorCount = 1;
+            w.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            w.pBufferInfo = &bufInfo;
+
+            vkUpdateDescriptorSets(device, 1, &w, 0, nullptr);
+        }
+
+        void destroyObjectBuffer(VkDevice device) noexcept
+        {
+            if (objectMapped)
+            {
+                vkUnmapMemory(device, objectMem);
+                objectMapped = nullptr;
+            }
+            if (objectBuffer)
+            {
+                vkDestroyBuffer(device, objectBuffer, nullptr);
+                objectBuffer = VK_NULL_HANDLE;
+            }
+            if (objectMem)
+            {
+                vkFreeMemory(device, objectMem, nullptr);
+                objectMem = VK_NULL_HANDLE;
+            }
+            objectCapacity = 0;
+        }
+
         // helper (local) to pick memory type index
         static uint32_t findMemoryTypeIndex(VkPhysicalDevice phys, uint32_t typeBits, VkMemoryPropertyFlags props)
         {
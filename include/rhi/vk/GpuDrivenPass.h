@@ -0,0 +1,165 @@
+#pragma once
+
+#include "rhi/vk/gfx/Buffer.h"
+
+#include <vulkan/vulkan.h>
+#include <vk_mem_alloc.h>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Render
+{
+    class Material;
+    struct ObjectData;
+}
+
+namespace Vk
+{
+    namespace Gfx
+    {
+        struct DrawItem;
+    }
+
+    struct RecordStats;
+    class UploadContext;
+
+    /// Counters of the GPU-driven path (see GpuDrivenPass::stats()).
+    struct GpuDrivenStats
+    {
+        uint32_t objects = 0;   ///< scene objects culled by the compute pass every frame
+        uint32_t batches = 0;   ///< indirect-count draws per frame (material x geometry page)
+        double cullGpuMs = 0.0; ///< compute pass of the last finished frame (0 without timestamps)
+        double setSceneMs = 0.0; ///< CPU time of the last setScene()
+    };
+
+    /**
+     * @brief GPU-driven scene pass: compute frustum culling + vkCmdDrawIndexedIndirectCount.
+     *
+     * setScene() fills, once per scene list, storage buffers with:
+     *   - per object: world bounding sphere, LOD 0 index range and batch (CullObject in cull.comp);
+     *   - per object: Render::ObjectData (model + normal matrix), read by the vertex shader
+     *     at gl_InstanceIndex exactly like the CPU path's per-image object buffer;
+     *   - per batch (objects sharing material + geometry page): its first slot in the indirect buffer.
+     *
+     * Every frame recordCull() zeroes the image's per-batch counters and dispatches shaders/cull.spv,
+     * which appends one VkDrawIndexedIndirectCommand per visible object (firstInstance = object);
+     * recordDraws() then issues one vkCmdDrawIndexedIndirectCount per batch. The CPU cost of a
+     * frame depends on the number of batches, not on the number of objects.
+     *
+     * Per swapchain image: indirect + count buffers, the compute set, a set=0 view set
+     * (that image's view UBO + the scene object buffer) and a timestamp pair. Only these are
+     * rebuilt on swapchain recreation (setImages()); the scene buffers stay.
+     *
+     * Requires VulkanLogicalDevice::supportsIndirectCount(). Objects draw LOD 0 without
+     * meshlet culling; LOD selection and cluster culling stay on the CPU path.
+     */
+    class GpuDrivenPass
+    {
+    public:
+        GpuDrivenPass() = default;
+        ~GpuDrivenPass() noexcept { destroy(); }
+
+        GpuDrivenPass(const GpuDrivenPass &) = delete;
+        GpuDrivenPass &operator=(const GpuDrivenPass &) = delete;
+
+        /**
+         * @brief Create the cull pipeline (independent of the swapchain).
+         * @param timestampPeriodNs VkPhysicalDeviceLimits::timestampPeriod, 0 to skip GPU timing
+         * @throws std::runtime_error if shaders/cull.spv is missing or a Vulkan call fails.
+         */
+        void create(VmaAllocator allocator, VkDevice device, float timestampPeriodNs = 0.0f);
+
+        /// Destroy everything. Safe to call multiple times; the device must be idle.
+        void destroy() noexcept;
+
+        /**
+         * @brief (Re)create the per-image state after (re)creating the swapchain; the scene
+         *        buffers are kept. The device must be idle.
+         * @param viewSetLayout GraphicsPipeline set=0 layout (view UBO + object buffer)
+         * @param viewUbos      Per-image view UBOs (RendererContext::createViewResources)
+         */
+        void setImages(VkDescriptorSetLayout viewSetLayout, const std::vector<VkBuffer> &viewUbos);
+
+        /**
+         * @brief (Re)build the object and batch buffers from @p sceneItems. The device must be idle.
+         *        The buffers are device-local, written through @p upload (directly on UMA / ReBAR,
+         *        else staged), and the batch is flushed before returning.
+         * @param sceneObjects    ObjectData of @p sceneItems by scene index (Render::DrawListBuilder::sceneObjects)
+         * @param sceneGeneration Render::Scene::generation() of @p sceneItems (see sceneGeneration()).
+         */
+        void setScene(UploadContext &upload, const std::vector<Gfx::DrawItem> &sceneItems,
+                      const std::vector<Render::ObjectData> &sceneObjects, uint64_t sceneGeneration = 0);
+
+        /**
+         * @brief Per-frame setup of @p imageIndex, once its previous submission has completed:
+         *        reads that submission's cull timestamps and keeps the frustum of @p viewProj.
+         */
+        void prepare(uint32_t imageIndex, const glm::mat4 &viewProj);
+
+        /// Outside rendering: reset counters, cull, make the commands visible to indirect draws.
+        void recordCull(VkCommandBuffer cmd, uint32_t imageIndex);
+
+        /// Inside rendering with the graphics pipeline bound: one indirect-count draw per batch.
+        void recordDraws(VkCommandBuffer cmd, uint32_t imageIndex, VkPipelineLayout layout,
+                         VkDescriptorSet lightingSet, RecordStats &stats) const;
+
+        /// Pipeline created and a non-empty scene set.
+        [[nodiscard]] bool ready() const noexcept { return pipeline_ != VK_NULL_HANDLE && objectCount_ > 0; }
+        [[nodiscard]] const GpuDrivenStats &stats() const noexcept { return stats_; }
+        /// Generation passed to the last setScene(); the scene must be set again once it differs.
+        [[nodiscard]] uint64_t sceneGeneration() const noexcept { return sceneGeneration_; }
+
+    private:
+        struct Batch
+        {
+            const Render::Material *material = nullptr;
+            VkBuffer vertices = VK_NULL_HANDLE;
+            VkBuffer indices = VK_NULL_HANDLE;
+            uint32_t first = 0;    // first slot in the indirect buffer
+            uint32_t capacity = 0; // objects in the batch (maxDrawCount)
+        };
+
+        struct PerImage
+        {
+            Gfx::Buffer commands; // VkDrawIndexedIndirectCommand per object
+            Gfx::Buffer counts;   // uint per batch
+            VkDescriptorSet cullSet = VK_NULL_HANDLE;
+            VkDescriptorSet viewSet = VK_NULL_HANDLE;
+            VkBuffer viewUbo = VK_NULL_HANDLE;
+            std::array<glm::vec4, 6> planes{};
+            bool timed = false; // timestamps written by a recorded cull (readable once it completed)
+        };
+
+        void createPipeline();
+        void destroyImages() noexcept;
+        void createOutputs();
+        void writeSets();
+
+        VmaAllocator allocator_ = VK_NULL_HANDLE;
+        VkDevice device_ = VK_NULL_HANDLE;
+
+        VkDescriptorSetLayout cullSetLayout_ = VK_NULL_HANDLE;
+        VkPipelineLayout pipelineLayout_ = VK_NULL_HANDLE;
+        VkPipeline pipeline_ = VK_NULL_HANDLE;
+        VkDescriptorPool pool_ = VK_NULL_HANDLE;
+        VkQueryPool timestamps_ = VK_NULL_HANDLE;
+        float timestampPeriodNs_ = 0.0f;
+
+        // Scene (setScene)
+        Gfx::Buffer cullObjects_;  // CullObject per object
+        Gfx::Buffer sceneObjects_; // Render::ObjectData per object
+        Gfx::Buffer batchFirst_;   // uint per batch
+        std::vector<Batch> batches_;
+        uint32_t objectCount_ = 0;
+        uint64_t sceneGeneration_ = 0;
+
+        std::vector<PerImage> images_;
+        GpuDrivenStats stats_{};
+    };
+
+} // namespace Vk
@@ -15,10 +15,11 @@ namespace Vk
      *
      * Descriptor set layout:
      *   set = 0, binding = 0 : UBO with Render::ViewUniforms (view / proj / viewProj / cameraPos) — VS
+     *   set = 0, binding = 1 : storage buffer of Render::ObjectData, indexed by gl_InstanceIndex — VS
      *   set = 1, binding = 0 : combined image sampler (albedo) — FS
+     *   set = 2              : lighting (see Render::LightManager)
      *
-     * Push constants:
-     *   - vertex stage: mat4 model (64 bytes)
+     * No push constants: per-object data comes from the object buffer (CommandBuffers or GpuDrivenPass).
      *
      * NOTE: Uses dynamic rendering (Vulkan 1.3+)
      */
@@ -47,12 +48,11 @@ namespace Vk
         VkPipeline pipeline{VK_NULL_HANDLE};
 
         // set layouts
-        VkDescriptorSetLayout viewSetLayout{VK_NULL_HANDLE};     // set=0 (VS UBO)
+        VkDescriptorSetLayout viewSetLayout{VK_NULL_HANDLE};     // set=0 (view UBO + object buffer)
         VkDescriptorSetLayout materialSetLayout{VK_NULL_HANDLE}; // set=1 (FS albedo sampler)
         VkDescriptorSetLayout lightingSetLayout{VK_NULL_HANDLE}; // set=2 (UBO + 3 SSBO)
 
         VkShaderModule createShaderModule(const std::vector<char> &code) const;
-        std::vector<char> readFile(const std::string &filename) const;
     };
 
 } // namespace Vk
\ No newline at end of file
@@ -12,17 +12,19 @@
 #include "ImageViews.h"
 #include "ui/ImGuiLayer.h"
 
-#include "rhi/vk/gfx/Mesh.h"
+#include "rhi/vk/gfx/DrawItem.h"
 
 #include "rhi/vk/FrameResources.h"
 
 #include <vulkan/vulkan.h>
 #include <vector>
 #include <cstdint>
+#include <functional>
 
 namespace Render
 {
     struct ViewUniforms;
+    struct ObjectData;
 }
 
 namespace UI
@@ -32,6 +34,12 @@ namespace UI
 
 namespace Vk
 {
+    namespace Gfx
+    {
+        class StreamingIndexBuffer;
+    }
+
+    class GpuDrivenPass;
 
     /**
      * @brief Shared per-frame/per-swapchain rendering resources.
@@ -39,7 +47,8 @@ namespace Vk
      * Owns:
      *  - Descriptor pool for view UBO
      *  - Per-image UBO buffers + device memory
-     *  - Per-image descriptor sets (set=0, binding=0)
+     *  - Per-image object buffers (model + normal matrix per draw)
+     *  - Per-image descriptor sets (set=0: binding 0 view UBO, binding 1 object buffer)
      *
      * Does NOT own:
      *  - GraphicsPipeline's descriptor set layout (taken from pipeline)
@@ -63,9 +72,22 @@ namespace Vk
         DepthResources &depth;
         UI::ImGuiLayer *imguiLayer;
 
-        // Draw list is just borrowed pointers (no ownership)
-        std::vector<const Vk::Gfx::Mesh *>
-            drawList;
+        // This frame's draw list (borrowed; built by Render::DrawListBuilder) and the lighting set.
+        // FrameRenderer re-records the acquired image's scene command buffer from them every frame.
+        const std::vector<Vk::Gfx::DrawItem> *frameDrawItems = nullptr;
+        // Object buffer entries of frameDrawItems (same order), copied into the image's object buffer.
+        const std::vector<Render::ObjectData> *frameObjects = nullptr;
+        VkDescriptorSet lightingSet = VK_NULL_HANDLE;
+
+        // Optional pass run with the acquired image index once that image's previous submission
+        // has finished, right before its scene command buffer is recorded (cluster culling fills
+        // the image's slot of clusterIndices here).
+        std::function<void(uint32_t imageIndex)> prepareImage;
+        const Vk::Gfx::StreamingIndexBuffer *clusterIndices = nullptr;
+
+        // GPU-driven path (optional): when set and ready, the scene is culled and drawn from its
+        // indirect buffers and frameDrawItems / frameObjects are not used for the scene pass.
+        GpuDrivenPass *gpuDriven = nullptr;
 
         RendererContext(VulkanInstance &i,
                         VulkanPhysicalDevice &p,
@@ -104,6 +126,12 @@ namespace Vk
          */
         void updateViewUbo(uint32_t imageIndex, const Render::ViewUniforms &uboData) const;
 
+        /**
+         * @brief Copy @p objects into the image's object buffer (grown if needed).
+         *        The image's previous submission must have completed.
+         */
+        void updateObjects(uint32_t imageIndex, const std::vector<Render::ObjectData> &objects) const;
+
         /**
          * @brief Destroy UBO buffers/memory and descriptor pool.
          *        Safe to call multiple times.
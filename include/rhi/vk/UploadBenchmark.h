@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <vk_mem_alloc.h>
+
+namespace Vk
+{
+
+    class UploadContext;
+    class VulkanLogicalDevice;
+
+    /**
+     * @brief Startup upload benchmark (EngineConfig::uploadBenchMiB).
+     *
+     * Pushes @p bytes through each upload path into a fresh buffer and logs one
+     * "UploadBench:" line per path with the best of a few runs, submit + fence wait included:
+     *  - staging ring -> device-local buffer on @p upload's queue (the transfer queue when
+     *    the device has a dedicated family);
+     *  - staging ring -> device-local buffer on the graphics queue (a temporary context of
+     *    the same ring size; skipped when @p upload already copies on the graphics queue);
+     *  - direct memcpy + flush into mapped host-visible memory (UploadContext::writeBuffer),
+     *    which is device-local only on UMA / ReBAR devices.
+     *
+     * Blocks; call it with no upload batch pending that the frame depends on.
+     */
+    void runUploadBenchmark(const VulkanLogicalDevice &device, VmaAllocator allocator,
+                            UploadContext &upload, VkDeviceSize bytes);
+
+} // namespace Vk
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <vk_mem_alloc.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "rhi/vk/gfx/Buffer.h"
+
+namespace Vk
+{
+
+    /**
+     * @brief Batches resource uploads into a few command buffers and one fence wait.
+     *
+     * Buffers, textures and lights record their staging copies, layout transitions
+     * and mip blits into the open batch instead of submitting (and vkQueueWaitIdle-ing)
+     * one command buffer each.
+     *
+     * Staging memory is suballocated from one persistently mapped ring buffer.
+     * A range is recycled when the fence of the batch that copied from it signals;
+     * uploads larger than half the ring are split into chunked copies.
+     *
+     * Queues: copies run on the transfer queue. When that is a separate family
+     * (dedicated DMA engine), every batch is two submits: the transfer command
+     * buffer (copies + ownership release) signals a semaphore that the graphics
+     * command buffer (ownership acquire, mip blits, final layouts) waits on.
+     * The frame never waits on either; only the batch fence does.
+     * With one family both halves are the same command buffer on one submit.
+     *
+     * Usage:
+     *  - Any copy call may submit the open batch (ring half full or wrapping), so
+     *    re-fetch commands() after copying instead of caching the handle.
+     *  - Images: record the copy on commands(), hand the image over with
+     *    transferOwnership(), then record graphics-only work on graphicsCommands().
+     *  - flush() before the uploaded resources are used by the frame loop, or
+     *    submit() + isComplete() to stream without blocking; poll() once per frame.
+     *
+     * Not thread-safe; one context per recording thread.
+     */
+    class UploadContext final
+    {
+    public:
+        /// Counters since construction (reported after scene load).
+        struct Stats
+        {
+            uint64_t submits = 0;          ///< vkQueueSubmit calls
+            uint64_t waits = 0;            ///< blocking fence waits (any reason)
+            uint64_t copies = 0;           ///< copy commands recorded (chunks count individually)
+            uint64_t stagedBytes = 0;      ///< total bytes written to the ring
+            uint64_t commandBuffers = 0;   ///< command buffers ever allocated (recycled afterwards)
+            uint64_t ringStalls = 0;       ///< waits forced because the ring wrapped onto in-flight data
+            uint64_t ringPeakBytes = 0;    ///< high-water mark of ring bytes not yet recycled
+            double activeMs = 0.0;         ///< time spent in copy calls and waits
+
+            uint64_t batchesCompleted = 0; ///< batches whose fence was seen signalled
+            double latencyMsTotal = 0.0;   ///< sum of submit -> completion-observed times
+            double latencyMsMax = 0.0;     ///< worst submit -> completion-observed time
+
+            uint64_t directWrites = 0; ///< writeBuffer() calls served by a direct memcpy (UMA / ReBAR)
+            uint64_t directBytes = 0;  ///< bytes written directly into destination allocations
+            double directMs = 0.0;     ///< time spent in direct writes (memcpy + flush)
+
+            /// Staging throughput over the time spent uploading.
+            [[nodiscard]] double bytesPerSecond() const noexcept
+            {
+                return activeMs > 0.0 ? double(stagedBytes) * 1000.0 / activeMs : 0.0;
+            }
+            /// Average batch latency (resolution is the poll() interval, typically one frame).
+            [[nodiscard]] double averageLatencyMs() const noexcept
+            {
+                return batchesCompleted > 0 ? latencyMsTotal / double(batchesCompleted) : 0.0;
+            }
+            /// Direct-write throughput.
+            [[nodiscard]] double directBytesPerSecond() const noexcept
+            {
+                return directMs > 0.0 ? double(directBytes) * 1000.0 / directMs : 0.0;
+            }
+        };
+
+        /**
+         * @param transferFamily / transferQueue Queue the copies are submitted to.
+         * @param graphicsFamily / graphicsQueue Queue that consumes the uploads (may equal the transfer pair).
+         * @param ringBytes                      Size of the persistently mapped staging ring.
+         * @param imageGranularity               minImageTransferGranularity of the transfer family: banded
+         *                                       image copies start on multiples of its height (1 = any row).
+         */
+        UploadContext(VmaAllocator allocator,
+                      VkDevice device,
+                      uint32_t transferFamily,
+                      VkQueue transferQueue,
+                      uint32_t graphicsFamily,
+                      VkQueue graphicsQueue,
+                      VkDeviceSize ringBytes = VkDeviceSize(64) << 20,
+                      VkExtent3D imageGranularity = {1, 1, 1});
+        ~UploadContext() noexcept;
+
+        UploadContext(const UploadContext &) = delete;
+        UploadContext &operator=(const UploadContext &) = delete;
+
+        /// Transfer-queue command buffer of the open batch (begins one if none is open).
+        [[nodiscard]] VkCommandBuffer commands();
+
+        /// Graphics-queue command buffer of the open batch (blits, final layouts); same as commands() with one family.
+        [[nodiscard]] VkCommandBuffer graphicsCommands();
+
+        /**
+         * @brief Hand every mip of @p image in @p layout over from the transfer to the graphics family
+         *        (release on commands(), acquire on graphicsCommands()). No-op with one family.
+         *        Record it after the last copy into the image and before any graphicsCommands() use.
+         */
+        void transferOwnership(VkImage image, VkImageLayout layout, uint32_t mipLevels);
+
+        /// Stage @p data and record a copy into @p dst at @p dstOffset (chunked if large).
+        void copyToBuffer(const void *data, VkDeviceSize bytes,
+                          VkBuffer dst, VkDeviceSize dstOffset = 0);
+
+        /**
+         * @brief Fill @p dst at @p dstOffset by the cheapest path available.
+         *        Host-visible destinations (see Gfx::Buffer::createDeviceLocal) get a direct
+         *        memcpy + flush with no copy or submit; others go through copyToBuffer().
+         */
+        void writeBuffer(Gfx::Buffer &dst, const void *data, VkDeviceSize bytes, VkDeviceSize dstOffset = 0);
+
+        /**
+         * @brief Stage tightly packed pixels and record copies into mip 0 of @p dst.
+         *        @p dst must already be in TRANSFER_DST_OPTIMAL; large images are
+         *        split into bands of whole rows (band heights rounded to the transfer
+         *        family's image granularity).
+         */
+        void copyToImage(const void *pixels, uint32_t width, uint32_t height,
+                         uint32_t bytesPerPixel, VkImage dst);
+
+        /// One pre-built mip level inside the data passed to copyLevelsToImage().
+        struct ImageLevel
+        {
+            VkDeviceSize offset = 0; // bytes from the start of the data
+            VkDeviceSize bytes = 0;
+            uint32_t width = 0;
+            uint32_t height = 0;
+        };
+
+        /**
+         * @brief Stage a complete mip chain (level i -> mip i) and record its copies into @p dst.
+         *        Texels are stored in @p blockDim x @p blockDim blocks of @p blockBytes
+         *        (1 / bytes per pixel for uncompressed formats). A chain that fits in half the
+         *        ring is one staging write and one vkCmdCopyBufferToImage; larger levels are
+         *        split into bands of whole block rows (a multiple of the granularity, which
+         *        counts blocks for compressed formats). @p dst must be in TRANSFER_DST_OPTIMAL.
+         */
+        void copyLevelsToImage(const void *data, const ImageLevel *levels, uint32_t levelCount,
+                               uint32_t blockDim, uint32_t blockBytes, VkImage dst);
+
+        /**
+         * @brief Submit the open batch without waiting.
+         * @return Ticket to pass to wait(); the last submitted ticket if nothing was recorded.
+         */
+        uint64_t submit();
+
+        /// Block until every batch up to @p ticket has completed, then recycle them.
+        void wait(uint64_t ticket);
+
+        /// Submit the open batch and wait for everything in flight.
+        void flush() { wait(submit()); }
+
+        /// Recycle every batch whose fence has already signalled (never blocks).
+        void poll();
+
+        /// True once the batch @p ticket (and everything before it) has completed; polls first.
+        [[nodiscard]] bool isComplete(uint64_t ticket);
+
+        [[nodiscard]] const Stats &stats() const noexcept { return stats_; }
+        [[nodiscard]] VkDeviceSize ringCapacity() const noexcept { return ringSize_; }
+        [[nodiscard]] uint32_t inFlightBatches() const noexcept { return uint32_t(inFlight_.size()); }
+        /// Copies run on a different queue family than the one consuming them.
+        [[nodiscard]] bool crossFamily() const noexcept { return transferFamily_ != graphicsFamily_; }
+        /// Ring bytes written but not yet recycled (open + in-flight batches).
+        [[nodiscard]] VkDeviceSize ringOccupancy() const noexcept { return VkDeviceSize(ringHead_ - ringTail_); }
+
+        [[nodiscard]] VmaAllocator allocator() const noexcept { return allocator_; }
+        [[nodiscard]] VkDevice device() const noexcept { return device_; }
+
+    private:
+        struct Batch
+        {
+            VkCommandBuffer cmd{VK_NULL_HANDLE};       // transfer queue
+            VkCommandBuffer gfxCmd{VK_NULL_HANDLE};    // graphics queue (cross-family only)
+            VkSemaphore copiesDone{VK_NULL_HANDLE};    // transfer submit -> graphics submit (cross-family only)
+            VkFence fence{VK_NULL_HANDLE};             // signalled by the last submit of the batch
+            std::chrono::steady_clock::time_point submitted{};
+            uint64_t ticket{0};
+            uint64_t ringBegin{0}; // monotonic ring position of the first byte this batch staged
+            uint64_t ringEnd{0};   // ... one past the last byte
+        };
+
+        /// Reserve @p bytes (<= half the ring) at @p alignment; returns the ring offset.
+        VkDeviceSize acquire(VkDeviceSize bytes, VkDeviceSize alignment);
+        /// Rows per image band: all @p rows if they fit in @p fitRows, else the largest granularity
+        /// multiple that does (0 when not even one granularity step fits).
+        [[nodiscard]] uint32_t bandRows(uint32_t rows, VkDeviceSize fitRows) const noexcept;
+        /// Copy into the ring at @p offset and flush for non-coherent memory.
+        void write(VkDeviceSize offset, const void *data, VkDeviceSize bytes);
+
+        /// Release @p range of @p dst on the transfer side and acquire it on the graphics side.
+        void transferOwnership(VkBuffer dst, VkDeviceSize offset, VkDeviceSize size);
+
+        void open();
+        void waitUntil(uint64_t ticket);
+        void retire(Batch &batch);
+
+        VmaAllocator allocator_{VK_NULL_HANDLE};
+        VkDevice device_{VK_NULL_HANDLE};
+        VkQueue transferQueue_{VK_NULL_HANDLE};
+        VkQueue graphicsQueue_{VK_NULL_HANDLE};
+        uint32_t transferFamily_{0};
+        uint32_t graphicsFamily_{0};
+        uint32_t bandRowMultiple_{1}; // image granularity height: band starts / heights are multiples of it
+        VkCommandPool pool_{VK_NULL_HANDLE};    // transfer family
+        VkCommandPool gfxPool_{VK_NULL_HANDLE}; // graphics family (cross-family only)
+
+        // Staging ring: monotonic head/tail, offset = position % ringSize_
+        Gfx::Buffer ring_;
+        std::byte *ringMapped_{nullptr};
+        VkDeviceSize ringSize_{0};
+        uint64_t ringHead_{0}; // next free byte
+        uint64_t ringTail_{0}; // oldest byte still owned by a batch
+
+        bool recording_{false};
+        Batch current_{};
+        std::deque<Batch> inFlight_; // oldest first
+        std::vector<Batch> free_;    // completed batches (cmd + fence reused)
+
+        uint64_t nextTicket_{1};
+        uint64_t lastSubmitted_{0};
+        uint64_t lastCompleted_{0};
+        Stats stats_{};
+    };
+
+} // namespace Vk
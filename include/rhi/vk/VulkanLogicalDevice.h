@@ -8,11 +8,16 @@ namespace Vk
     class VulkanPhysicalDevice;
 
     /**
-     * @brief RAII wrapper over VkDevice + retrieval of graphics/present queues.
+     * @brief RAII wrapper over VkDevice + retrieval of graphics/present/transfer queues.
      *
+     * - The transfer queue comes from a dedicated non-graphics family when the GPU has one;
+     *   otherwise it aliases the graphics queue (check hasDedicatedTransferQueue()).
      * - Enables VK_KHR_swapchain (required for presenting).
      * - Enables VK_KHR_portability_subset if the physical device advertises it (MoltenVK).
      * - Requests Vulkan 1.3 feature: synchronization2 (already used by your code).
+     * - Enables textureCompressionBC when available (see supportsBlockCompression()).
+     * - Enables drawIndirectCount + multiDrawIndirect + drawIndirectFirstInstance when all
+     *   are available (see supportsIndirectCount()).
      */
     class VulkanLogicalDevice
     {
@@ -26,17 +31,35 @@ namespace Vk
         VkDevice getDevice() const noexcept { return device; }
         VkQueue getGraphicsQueue() const noexcept { return graphicsQueue; }
         VkQueue getPresentQueue() const noexcept { return presentQueue; }
+        VkQueue getTransferQueue() const noexcept { return transferQueue; }
 
         [[nodiscard]] uint32_t getGraphicsQueueFamilyIndex() const noexcept { return graphicsQueueFamilyIndex_; }
         [[nodiscard]] uint32_t getPresentQueueFamilyIndex() const noexcept { return presentQueueFamilyIndex_; }
+        [[nodiscard]] uint32_t getTransferQueueFamilyIndex() const noexcept { return transferQueueFamilyIndex_; }
+
+        /// True when uploads run on their own family (requires queue-family ownership transfers).
+        [[nodiscard]] bool hasDedicatedTransferQueue() const noexcept
+        {
+            return transferQueueFamilyIndex_ != graphicsQueueFamilyIndex_;
+        }
+
+        /// BC4/BC5/BC7 images can be sampled (feature enabled + formats support linear filtering).
+        [[nodiscard]] bool supportsBlockCompression() const noexcept { return blockCompression_; }
+
+        /// vkCmdDrawIndexedIndirectCount with many draws and non-zero firstInstance (GPU-driven path).
+        [[nodiscard]] bool supportsIndirectCount() const noexcept { return indirectCount_; }
 
     private:
         VkDevice device{VK_NULL_HANDLE};
         VkQueue graphicsQueue{VK_NULL_HANDLE};
         VkQueue presentQueue{VK_NULL_HANDLE};
+        VkQueue transferQueue{VK_NULL_HANDLE};
 
         uint32_t graphicsQueueFamilyIndex_ = 0;
         uint32_t presentQueueFamilyIndex_ = 0;
+        uint32_t transferQueueFamilyIndex_ = 0;
+        bool blockCompression_ = false;
+        bool indirectCount_ = false;
     };
 
 } // namespace Vk
@@ -14,6 +14,11 @@ namespace Vk
     {
         std::optional<uint32_t> graphicsFamily;
         std::optional<uint32_t> presentFamily;
+        /// Non-graphics family with TRANSFER (DMA engine); empty when uploads must share the graphics queue.
+        std::optional<uint32_t> transferFamily;
+        /// minImageTransferGranularity of transferFamily: image copies on it must start on (and, short of
+        /// the mip's edge, span) multiples of this. Families reporting (0,0,0) are never picked.
+        VkExtent3D transferGranularity{1, 1, 1};
 
         bool isComplete() const
         {
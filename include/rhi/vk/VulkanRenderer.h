@@ -2,7 +2,10 @@
 
 #include "platform/WindowManager.h"
 #include "platform/guards/GLFWInitializer.h"
+#include "core/EngineConfig.h"
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -15,6 +18,7 @@ namespace Render
     class Scene;
     class MaterialSystem;
     class LightManager;
+    class DrawListBuilder;
 }
 
 namespace Input
@@ -45,6 +49,15 @@ namespace Vk
     struct RendererContext;
     class FrameRenderer;
     class DepthResources;
+    class UploadContext;
+    class GpuDrivenPass;
+
+    namespace Gfx
+    {
+        class Buffer;
+        class GeometryArena;
+        class StreamingIndexBuffer;
+    }
 
     /**
      * @brief High-level Vulkan application driver.
@@ -93,6 +106,9 @@ namespace Vk
         /// Window wrapper (GLFW, Vulkan-compatible).
         Platform::WindowManager window;
 
+        /// Startup tunables (engine.cfg next to the working directory; defaults if absent).
+        Core::EngineConfig config;
+
         // ---- Core Vulkan objects (creation order matters) ----
         std::unique_ptr<VulkanInstance> instance;             // VkInstance + validation/extensions
         std::unique_ptr<Surface> surface;                     // VkSurfaceKHR (from GLFW window)
@@ -110,10 +126,11 @@ namespace Vk
         std::unique_ptr<Framebuffers> framebuffers; // One framebuffer per swapchain image
 
         // ---- GPU pipeline & command subsystem ----
-        std::unique_ptr<GraphicsPipeline> graphicsPipeline; // VS/FS, fixed states, layout (UBO+PC)
+        std::unique_ptr<GraphicsPipeline> graphicsPipeline; // VS/FS, fixed states, layout (UBO+SSBO)
         std::unique_ptr<CommandPool> commandPool;           // Graphics command pool
         std::unique_ptr<CommandBuffers> commandBuffers;     // One primary CB per swapchain image
         std::unique_ptr<SyncObjects> syncObjects;           // Semaphores/fences per frame
+        std::unique_ptr<UploadContext> uploadContext;       // Batched staging copies for content loads
 
         // ---- Render orchestration ----
         std::unique_ptr<RendererContext> ctx;         // Per-image UBOs, descriptor sets, shared refs
@@ -123,6 +140,11 @@ namespace Vk
         std::unique_ptr<Render::Scene> scene;
         std::unique_ptr<Render::MaterialSystem> materials;
         std::unique_ptr<Render::LightManager> lightMgr;
+        std::unique_ptr<Gfx::GeometryArena> geometry;                  // shared vertex/index pages all meshes suballocate from
+        std::unique_ptr<Render::DrawListBuilder> drawListBuilder;     // per-frame draw list (LOD selection, cluster culling)
+        std::unique_ptr<Gfx::StreamingIndexBuffer> clusterIndexStream; // per-image indices of visible meshlets
+        std::unique_ptr<GpuDrivenPass> gpuDriven;                      // compute culling + indirect-count draws (if supported)
+        bool gpuDrivenEnabled = false;                                 // Stats window toggle: GPU-driven vs. CPU draw list
 
         // ---- Camera ----
         std::unique_ptr<Render::OrbitCamera> orbitCamera; // Simple orbit camera for first view
@@ -136,6 +158,36 @@ namespace Vk
         // --- ImGUI ---
         std::unique_ptr<UI::ImGuiLayer> imguiLayer;
 
+        /// Upload streaming test (Stats window): re-stages a scratch buffer every frame without waiting on it.
+        struct UploadStreamTest
+        {
+            bool enabled = false;
+            int kibPerFrame = 4096;
+            std::vector<std::byte> payload;
+            std::unique_ptr<Gfx::Buffer> target; // device-local, never sampled
+            uint64_t pendingTicket = 0;          // 0 = nothing in flight
+            std::chrono::steady_clock::time_point submittedAt{};
+            uint64_t uploads = 0;
+            uint64_t busyFrames = 0;     // frames skipped because the previous upload was still in flight
+            double latencyMs = 0.0;      // smoothed submit -> completion (one-frame resolution)
+            double frameMsStreaming = 0.0; // smoothed frame time while streaming
+            double frameMsIdle = 0.0;      // ... and with streaming off
+        };
+        UploadStreamTest uploadStream;
+
+        /// Smoke run (EngineConfig::smokeFrames): per-frame CPU/GPU timings summed after a warm-up.
+        struct SmokeRun
+        {
+            uint32_t frames = 0;   // rendered so far
+            uint32_t measured = 0; // frames past the warm-up
+            double frameMs = 0.0;  // whole loop iteration (includes waiting for the image's fence)
+            double buildMs = 0.0;  // CPU draw list (0 on GPU-driven frames)
+            double recordMs = 0.0; // scene command buffer recording
+            double cullGpuMs = 0.0; // GPU-driven compute pass (timestamps)
+            uint32_t gpuFrames = 0; // measured frames drawn by the GPU-driven pass
+        };
+        SmokeRun smoke;
+
         // ---- State flags ----
         bool framebufferResized = false; // Legacy flag (can be driven by GLFW callback)
         bool swapchainDirty = false;     // Set on resize/surface invalidation, checked in maybeRecreateSwapchain()
@@ -147,6 +199,20 @@ namespace Vk
         /// Poll events, optionally recreate swapchain, and render frames until window closes.
         void mainLoop();
 
+        /// Create the GPU-driven pass for the current pipeline / view UBOs and upload the scene.
+        /// No-op on devices without drawIndirectCount.
+        void createGpuDrivenPass();
+
+        /// Point the GPU-driven pass at the current swapchain images (after createViewResources()).
+        /// The device must be idle.
+        void updateGpuDrivenImages();
+
+        /// Advance the upload streaming test by one frame (never blocks on the GPU).
+        void streamUploads(float frameMs);
+
+        /// Account one rendered frame of a smoke run; logs the averages and returns true after the last one.
+        bool smokeFrame(double frameMs, double buildMs);
+
         /// Destroy resources in reverse order; waits for device idle when safe.
         void cleanup();
     };
@@ -5,6 +5,11 @@
 #include <cstdint>
 #include <stdexcept>
 
+namespace Vk
+{
+    class UploadContext;
+}
+
 namespace Vk::Gfx
 {
     /**
@@ -54,6 +59,20 @@ namespace Vk::Gfx
                     VmaAllocationCreateFlags allocFlags = 0,
                     const char *debugName = nullptr);
 
+        /**
+         * @brief Creates a buffer the GPU reads at full speed that the CPU may also write.
+         *
+         * Uses VMA_MEMORY_USAGE_AUTO with HOST_ACCESS_ALLOW_TRANSFER_INSTEAD: on UMA / ReBAR
+         * devices the allocation lands in DEVICE_LOCAL | HOST_VISIBLE memory and is mapped
+         * (see hostVisible()); otherwise it is plain device-local and filled via staging.
+         * TRANSFER_DST is always added so either path works.
+         */
+        void createDeviceLocal(VmaAllocator allocator,
+                               VkDevice device,
+                               VkDeviceSize size,
+                               VkBufferUsageFlags usage,
+                               const char *debugName = nullptr);
+
         /// Destroys the buffer + VMA allocation (safe to call multiple times).
         void destroy() noexcept;
 
@@ -65,6 +84,15 @@ namespace Vk::Gfx
         [[nodiscard]] VkDevice device() const noexcept { return device_; }
         /// Returns the VMA allocation (may be useful for advanced queries).
         [[nodiscard]] VmaAllocation allocation() const noexcept { return allocation_; }
+        /// Returns the VMA allocator the buffer was created with.
+        [[nodiscard]] VmaAllocator allocator() const noexcept { return allocator_; }
+        /// Property flags of the memory type VMA picked.
+        [[nodiscard]] VkMemoryPropertyFlags memoryProperties() const noexcept { return memProps_; }
+        /// True if the CPU can write the allocation directly (persistently mapped).
+        [[nodiscard]] bool hostVisible() const noexcept
+        {
+            return mapped_ && (memProps_ & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        }
 
         /**
          * @brief Maps the allocation and returns a pointer (only if HOST_VISIBLE).
@@ -81,32 +109,17 @@ namespace Vk::Gfx
         void upload(const void *data, size_t bytes, VkDeviceSize dstOffset = 0);
 
         /**
-         * @brief One-shot helper to copy entire buffer contents using a one-time command buffer.
-         *        Requires src.size() <= dst.size() and dst has TRANSFER_DST usage.
-         */
-        static void copyBuffer(VkDevice device,
-                               VkCommandPool cmdPool,
-                               VkQueue queue,
-                               VkBuffer src,
-                               VkBuffer dst,
-                               VkDeviceSize bytes);
-
-        /**
-         * @brief Convenience: create a GPU-only buffer and fill it via staging.
-         *        Internally creates a transient host buffer, uploads, copies, then frees it.
+         * @brief Convenience: create a device-local buffer (see createDeviceLocal) and fill it.
+         *        Host-visible allocations are written directly with no copy or submit;
+         *        otherwise the copy is recorded into @p upload and the data is valid on
+         *        the GPU once that batch has been submitted and waited on.
          *
-         * @param allocator   VMA allocator
-         * @param device      VkDevice
-         * @param cmdPool     Command pool for the one-time CB
-         * @param queue       Graphics/transfer queue for submission
+         * @param upload      Upload batch providing allocator, device and staging memory
          * @param data        Source data pointer
          * @param bytes       Data size
-         * @param usage       Destination buffer usage flags (must include TRANSFER_DST if upload is needed)
+         * @param usage       Destination buffer usage flags (TRANSFER_DST is added)
          */
-        void createDeviceLocalWithData(VmaAllocator allocator,
-                                       VkDevice device,
-                                       VkCommandPool cmdPool,
-                                       VkQueue queue,
+        void createDeviceLocalWithData(UploadContext &upload,
                                        const void *data,
                                        VkDeviceSize bytes,
                                        VkBufferUsageFlags usage,
@@ -127,6 +140,8 @@ namespace Vk::Gfx
             other.size_ = 0;
             mapped_ = other.mapped_;
             other.mapped_ = nullptr;
+            memProps_ = other.memProps_;
+            other.memProps_ = 0;
         }
 
         VkDevice device_{VK_NULL_HANDLE};
@@ -135,6 +150,7 @@ namespace Vk::Gfx
         VmaAllocation allocation_{VK_NULL_HANDLE};
         VkDeviceSize size_{0};
         void *mapped_{nullptr};
+        VkMemoryPropertyFlags memProps_{0};
     };
 
 } // namespace Vk::Gfx
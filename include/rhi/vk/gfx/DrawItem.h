@@ -1,6 +1,8 @@
 #pragma once
 #include "rhi/vk/gfx/Mesh.h"
 
+#include <glm/mat4x4.hpp>
+
 namespace Render
 {
     class Material;
@@ -14,7 +16,23 @@ namespace Vk::Gfx
     {
         const Vk::Gfx::Mesh *mesh{nullptr};
         const Render::Material *material{nullptr};
-        // NOTE: We take the model matrix from mesh->getLocalTransform(), so there is no field here.
+        // Local -> world. Instances of the same mesh share geometry and differ only here.
+        glm::mat4 transform{1.0f};
+        // Level of detail to draw (index into Mesh LODs); chosen per frame by Render::DrawListBuilder.
+        uint32_t lod{0};
+
+        // Entries of the frame's object buffer this item draws (gl_InstanceIndex range); set by
+        // Render::DrawListBuilder, which merges consecutive items of the same mesh, material and
+        // LOD into one item with instanceCount > 1.
+        uint32_t firstInstance{0};
+        uint32_t instanceCount{1};
+
+        // Set by the cluster culling pass (Render::DrawListBuilder::cullClusters): draw the
+        // visible LOD 0 meshlets, i.e. clusterIndexCount indices starting at clusterFirstIndex
+        // of the frame's streaming index buffer, instead of the mesh's own LOD range.
+        bool clustered{false};
+        uint32_t clusterFirstIndex{0};
+        uint32_t clusterIndexCount{0};
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "rhi/vk/gfx/Buffer.h"
+#include "rhi/vk/gfx/Vertex.h"
+
+#include <vulkan/vulkan.h>
+#include <vk_mem_alloc.h>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Vk::Gfx
+{
+    /**
+     * @brief Shared vertex/index storage for every mesh.
+     *
+     * Geometry lives in a few large device-local pages (one vertex buffer + one index
+     * buffer each) instead of two VMA allocations per mesh. A mesh is a Range into one
+     * page: indices stay mesh-local and are drawn with vertexOffset = baseVertex, so the
+     * recorder binds a page once and only changes offsets between draws.
+     *
+     * Space inside a page is handed out first-fit from a free list (in elements, not bytes);
+     * freed ranges coalesce with their neighbours. A new page is created when no existing
+     * page has room; meshes larger than a page get a page sized to fit.
+     *
+     * free() must only be called once the GPU no longer reads the range (device idle or
+     * after the frames that drew it have completed).
+     */
+    class GeometryArena
+    {
+    public:
+        /// Where a mesh's geometry lives.
+        struct Range
+        {
+            static constexpr uint32_t kNoPage = std::numeric_limits<uint32_t>::max();
+
+            uint32_t page = kNoPage;
+            uint32_t baseVertex = 0; ///< vertexOffset for vkCmdDrawIndexed
+            uint32_t vertexCount = 0;
+            uint32_t firstIndex = 0; ///< added to every LOD/meshlet firstIndex
+            uint32_t indexCount = 0;
+
+            [[nodiscard]] bool valid() const noexcept { return page != kNoPage; }
+        };
+
+        /// Occupancy snapshot (see stats()).
+        struct Stats
+        {
+            uint32_t pages = 0;
+            uint32_t vmaAllocations = 0; ///< 2 per page (vertex + index buffer)
+            uint32_t liveRanges = 0;
+            uint32_t freeBlocks = 0;     ///< fragmentation indicator (vertex + index free lists)
+            uint64_t vertexBytesUsed = 0;
+            uint64_t vertexBytesCapacity = 0;
+            uint64_t indexBytesUsed = 0;
+            uint64_t indexBytesCapacity = 0;
+        };
+
+        /**
+         * @param vertexPageBytes Default size of a page's vertex buffer.
+         * @param indexPageBytes  Default size of a page's index buffer.
+         */
+        GeometryArena(VmaAllocator allocator,
+                      VkDevice device,
+                      VkDeviceSize vertexPageBytes = VkDeviceSize(64) << 20,
+                      VkDeviceSize indexPageBytes = VkDeviceSize(32) << 20);
+        ~GeometryArena() = default;
+
+        GeometryArena(const GeometryArena &) = delete;
+        GeometryArena &operator=(const GeometryArena &) = delete;
+
+        /**
+         * @brief Reserve space for the mesh and record its upload into @p upload.
+         * @return Range to draw from; invalid if both spans are empty.
+         */
+        [[nodiscard]] Range allocate(UploadContext &upload,
+                                     std::span<const Vertex> vertices,
+                                     std::span<const uint32_t> indices);
+
+        /// Return @p range to its page's free lists (no-op for invalid ranges).
+        void free(const Range &range) noexcept;
+
+        [[nodiscard]] VkBuffer vertexBuffer(uint32_t page) const noexcept { return pages_[page].vertices.get(); }
+        [[nodiscard]] VkBuffer indexBuffer(uint32_t page) const noexcept { return pages_[page].indices.get(); }
+        [[nodiscard]] uint32_t pageCount() const noexcept { return static_cast<uint32_t>(pages_.size()); }
+
+        [[nodiscard]] Stats stats() const noexcept;
+
+    private:
+        /// First-fit free list over [0, capacity) elements; adjacent free blocks are merged.
+        class FreeList
+        {
+        public:
+            explicit FreeList(uint32_t capacity = 0);
+
+            [[nodiscard]] std::optional<uint32_t> allocate(uint32_t count);
+            void release(uint32_t offset, uint32_t count) noexcept;
+
+            [[nodiscard]] uint32_t capacity() const noexcept { return capacity_; }
+            [[nodiscard]] uint32_t used() const noexcept { return used_; }
+            [[nodiscard]] uint32_t blocks() const noexcept { return static_cast<uint32_t>(free_.size()); }
+
+        private:
+            std::map<uint32_t, uint32_t> free_; // offset -> count
+            uint32_t capacity_ = 0;
+            uint32_t used_ = 0;
+        };
+
+        struct Page
+        {
+            Buffer vertices;
+            Buffer indices;
+            FreeList vertexSpace;
+            FreeList indexSpace;
+            uint32_t liveRanges = 0;
+        };
+
+        /// Append a page large enough for the given counts; returns its index.
+        uint32_t addPage(uint32_t vertexCount, uint32_t indexCount);
+        /// Reserve both ranges in @p page, or neither.
+        bool tryAllocate(uint32_t page, uint32_t vertexCount, uint32_t indexCount, Range &out);
+
+        VmaAllocator allocator_{VK_NULL_HANDLE};
+        VkDevice device_{VK_NULL_HANDLE};
+        VkDeviceSize vertexPageBytes_{0};
+        VkDeviceSize indexPageBytes_{0};
+        std::vector<Page> pages_;
+    };
+
+} // namespace Vk::Gfx
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "rhi/vk/gfx/Buffer.h"
+#include "rhi/vk/gfx/GeometryArena.h"
 #include "rhi/vk/gfx/Vertex.h"
 
 #include <glm/mat4x4.hpp>
@@ -8,22 +8,48 @@
 #include <vulkan/vulkan.h>
 
 #include <cstdint>
+#include <span>
 #include <vector>
 #include <stdexcept>
 
 namespace Vk::Gfx
 {
     /**
-     * @brief Minimal GPU mesh: vertex + index buffers, local transform, CPU-side AABB.
+     * @brief Minimal GPU mesh: a vertex/index range in the GeometryArena, local transform, CPU-side AABB.
+     *
+     * The index buffer may hold several levels of detail over the same vertices
+     * (see setLods()); without a chain the whole buffer is LOD 0.
+     * LOD 0 may additionally be split into meshlets (see setMeshlets()); their indices are
+     * kept on the CPU so a culling pass can stream the visible ones into another buffer.
      *
      * Implementation details:
-     *  - Uses VMA-backed Buffer.
-     *  - Buffers are created as DEVICE_LOCAL and populated via a transient staging upload.
+     *  - Geometry is suballocated from a shared GeometryArena page; indices stay mesh-local
+     *    and are drawn with vertexOffset = baseVertex(), so meshes on one page share binds.
+     *  - The range is returned to the arena on destroy(); the arena must outlive the mesh.
      *  - Not copyable, but movable.
      */
     class Mesh
     {
     public:
+        /// Index range of one level of detail; error is in mesh-local units (0 = full detail).
+        struct Lod
+        {
+            uint32_t firstIndex = 0;
+            uint32_t indexCount = 0;
+            float error = 0.0f;
+        };
+
+        /// LOD 0 cluster: index range plus mesh-local bounding sphere and normal cone (see Asset::Meshlet).
+        struct Meshlet
+        {
+            uint32_t firstIndex = 0;
+            uint32_t indexCount = 0;
+            glm::vec3 center{0.0f};
+            float radius = 0.0f;
+            glm::vec3 coneAxis{0.0f};
+            float coneCutoff = 1.0f; // >= 1: no usable cone
+        };
+
         Mesh() = default;
         ~Mesh() noexcept { destroy(); }
 
@@ -42,62 +68,101 @@ namespace Vk::Gfx
         }
 
         /**
-         * @brief Create vertex/index buffers and upload data.
+         * @brief Reserve an arena range and upload data.
          * @throws std::runtime_error on invalid indices or Vulkan/VMA errors.
          *
-         * @param allocator    VMA allocator
-         * @param device       VkDevice
-         * @param cmdPool      Command pool for a one-time staging copy
-         * @param queue        Graphics/transfer queue for submission
+         * @param upload       Upload batch the staging copies are recorded into
+         * @param arena        Shared geometry storage the range is taken from
          * @param vertices     Vertex data
-         * @param indices      Index data (uint32)
+         * @param indices      Index data (uint32); may point into mapped/cached memory
          * @param local        Local transform (defaults to identity)
          */
-        void create(VmaAllocator allocator,
-                    VkDevice device,
-                    VkCommandPool cmdPool,
-                    VkQueue queue,
-                    const std::vector<Vertex> &vertices,
-                    const std::vector<uint32_t> &indices,
-                    const glm::mat4 &local = glm::mat4(1.0f),
-                    const std::string &meshPathOrName = "");
-
-        /// Destroy buffers (safe to call multiple times).
+        void create(UploadContext &upload,
+                    GeometryArena &arena,
+                    std::span<const Vertex> vertices,
+                    std::span<const uint32_t> indices,
+                    const glm::mat4 &local = glm::mat4(1.0f));
+
+        /**
+         * @brief Describe the LOD chain stored in the index buffer (finest first).
+         * @throws std::runtime_error if a range exceeds the mesh's indices.
+         *
+         * An empty span resets to a single LOD covering all indices.
+         */
+        void setLods(std::span<const Lod> lods);
+
+        /**
+         * @brief Attach LOD 0 meshlets and keep a CPU copy of their indices.
+         * @throws std::runtime_error if a meshlet exceeds @p indices or the LOD 0 range.
+         *
+         * @param meshlets  Clusters; firstIndex/indexCount address @p indices
+         * @param indices   The LOD 0 indices exactly as uploaded (same vertex numbering)
+         *
+         * Empty spans detach the meshlets.
+         */
+        void setMeshlets(std::span<const Meshlet> meshlets, std::span<const uint32_t> indices);
+
+        /// Return the range to the arena (safe to call multiple times).
         void destroy() noexcept
         {
-            ibo_.destroy();
-            vbo_.destroy();
+            if (arena_)
+                arena_->free(range_);
+            arena_ = nullptr;
+            range_ = {};
             indexCount_ = 0u;
+            lods_.clear();
+            meshlets_.clear();
+            meshletIndices_.clear();
             // Keep AABB and transform; harmless CPU state.
         }
 
-        /// Bind VBO/IBO to the given command buffer.
-        void bind(VkCommandBuffer cmd) const noexcept;
+        /// Issue an indexed draw of LOD @p lod (clamped to the chain). No-op if empty.
+        /// The arena page (vertexBuffer()/indexBuffer()) must be bound. Instances read the
+        /// frame's object buffer entries [firstInstance, firstInstance + instanceCount).
+        void draw(VkCommandBuffer cmd, uint32_t lod = 0, uint32_t firstInstance = 0,
+                  uint32_t instanceCount = 1) const noexcept;
 
-        /// Issue an indexed draw (1 instance). No-op if indexCount == 0.
-        void draw(VkCommandBuffer cmd) const noexcept;
+        /// Arena page buffers (VK_NULL_HANDLE for an empty mesh); bind them once per page.
+        [[nodiscard]] VkBuffer vertexBuffer() const noexcept { return range_.valid() ? arena_->vertexBuffer(range_.page) : VK_NULL_HANDLE; }
+        [[nodiscard]] VkBuffer indexBuffer() const noexcept { return range_.valid() ? arena_->indexBuffer(range_.page) : VK_NULL_HANDLE; }
+        /// vertexOffset for draws with mesh-local indices (own LODs or streamed meshlet indices).
+        [[nodiscard]] int32_t baseVertex() const noexcept { return static_cast<int32_t>(range_.baseVertex); }
+        /// Position of this mesh's index 0 in indexBuffer().
+        [[nodiscard]] uint32_t firstIndex() const noexcept { return range_.firstIndex; }
 
         // Accessors
         [[nodiscard]] const glm::mat4 &getLocalTransform() const noexcept { return localTransform_; }
         [[nodiscard]] uint32_t getIndexCount() const noexcept { return indexCount_; }
+        [[nodiscard]] uint32_t lodCount() const noexcept { return static_cast<uint32_t>(lods_.size()); }
+        [[nodiscard]] const Lod &lod(uint32_t i) const noexcept { return lods_[i]; }
+        [[nodiscard]] std::span<const Meshlet> meshlets() const noexcept { return meshlets_; }
+        [[nodiscard]] std::span<const uint32_t> meshletIndices() const noexcept { return meshletIndices_; }
         [[nodiscard]] const glm::vec3 &getMin() const noexcept { return aabbMin_; }
         [[nodiscard]] const glm::vec3 &getMax() const noexcept { return aabbMax_; }
 
     private:
         void moveFrom(Mesh &other) noexcept
         {
-            vbo_ = std::move(other.vbo_);
-            ibo_ = std::move(other.ibo_);
+            arena_ = other.arena_;
+            other.arena_ = nullptr;
+            range_ = other.range_;
+            other.range_ = {};
             indexCount_ = other.indexCount_;
             other.indexCount_ = 0u;
+            lods_ = std::move(other.lods_);
+            meshlets_ = std::move(other.meshlets_);
+            meshletIndices_ = std::move(other.meshletIndices_);
             aabbMin_ = other.aabbMin_;
             aabbMax_ = other.aabbMax_;
             localTransform_ = other.localTransform_;
         }
 
-        Buffer vbo_;
-        Buffer ibo_;
+        GeometryArena *arena_{nullptr};
+        GeometryArena::Range range_{};
         uint32_t indexCount_{0};
+        std::vector<Lod> lods_; // always >= 1 entry while the range exists
+        std::vector<Meshlet> meshlets_;
+        std::vector<uint32_t> meshletIndices_; // CPU copy of the LOD 0 indices the meshlets address
 
         glm::vec3 aabbMin_{0.0f};
         glm::vec3 aabbMax_{0.0f};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <map>
+#include <tuple>
+
+namespace Vk::Gfx
+{
+    /// Full sampler state (the SamplerCache key). Defaults: trilinear, repeat, 8x anisotropy.
+    struct SamplerDesc
+    {
+        VkFilter magFilter = VK_FILTER_LINEAR;
+        VkFilter minFilter = VK_FILTER_LINEAR;
+        VkSamplerMipmapMode mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+        VkSamplerAddressMode addressU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        VkSamplerAddressMode addressV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        VkSamplerAddressMode addressW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        float mipLodBias = 0.0f;
+        float maxAnisotropy = 8.0f; ///< <= 1 disables anisotropic filtering
+        bool compareEnable = false;
+        VkCompareOp compareOp = VK_COMPARE_OP_NEVER;
+        float minLod = 0.0f;
+        float maxLod = VK_LOD_CLAMP_NONE; ///< the image view's mip range already clamps per texture
+        VkBorderColor borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+
+        bool operator<(const SamplerDesc &o) const
+        {
+            return std::tie(magFilter, minFilter, mipmapMode, addressU, addressV, addressW, mipLodBias,
+                            maxAnisotropy, compareEnable, compareOp, minLod, maxLod, borderColor) <
+                   std::tie(o.magFilter, o.minFilter, o.mipmapMode, o.addressU, o.addressV, o.addressW, o.mipLodBias,
+                            o.maxAnisotropy, o.compareEnable, o.compareOp, o.minLod, o.maxLod, o.borderColor);
+        }
+    };
+
+    /**
+     * @brief One VkSampler per distinct SamplerDesc, shared by every texture that uses it.
+     *
+     * Samplers don't depend on the image: a texture's mip count is enforced by its
+     * view (levelCount), so textures of any size share the same sampler and the
+     * device's maxSamplerAllocationCount is never approached.
+     *
+     * Samplers live until destroy(); handles returned by get() stay valid until then.
+     */
+    class SamplerCache
+    {
+    public:
+        SamplerCache() = default;
+        ~SamplerCache() { destroy(); }
+
+        SamplerCache(const SamplerCache &) = delete;
+        SamplerCache &operator=(const SamplerCache &) = delete;
+
+        /// @param maxAnisotropy Device limit (VkPhysicalDeviceLimits::maxSamplerAnisotropy); requests are clamped to it.
+        void init(VkDevice device, float maxAnisotropy = 16.0f);
+
+        /// Destroy every sampler. Safe to call multiple times.
+        void destroy() noexcept;
+
+        /// Sampler for @p desc, created on first request.
+        [[nodiscard]] VkSampler get(const SamplerDesc &desc = {});
+
+        [[nodiscard]] uint32_t size() const noexcept { return static_cast<uint32_t>(samplers_.size()); }
+        [[nodiscard]] uint64_t requests() const noexcept { return requests_; }
+
+    private:
+        VkDevice device_ = VK_NULL_HANDLE;
+        float maxAnisotropy_ = 16.0f;
+        std::map<SamplerDesc, VkSampler> samplers_;
+        uint64_t requests_ = 0;
+    };
+
+} // namespace Vk::Gfx
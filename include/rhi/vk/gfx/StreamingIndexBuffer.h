@@ -0,0 +1,71 @@
+#pragma once
+
+#include "rhi/vk/gfx/Buffer.h"
+
+#include <vulkan/vulkan.h>
+#include <vk_mem_alloc.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Vk::Gfx
+{
+    /**
+     * @brief Host-written uint32 index buffer with one slot per swapchain image.
+     *
+     * Each frame the CPU writes the slot of the image it is about to record; that slot's
+     * previous contents were consumed by the image's last submission, which the caller must
+     * have waited for (FrameRenderer does so before recording).
+     *
+     * Implementation details:
+     *  - Slots are persistently mapped VMA buffers (AUTO + HOST_ACCESS_SEQUENTIAL_WRITE).
+     *  - A slot that is too small is recreated with 1.5x headroom; slots never shrink.
+     *  - Not copyable or movable (owned through std::unique_ptr).
+     */
+    class StreamingIndexBuffer
+    {
+    public:
+        StreamingIndexBuffer() = default;
+        ~StreamingIndexBuffer() noexcept { destroy(); }
+
+        StreamingIndexBuffer(const StreamingIndexBuffer &) = delete;
+        StreamingIndexBuffer &operator=(const StreamingIndexBuffer &) = delete;
+
+        /**
+         * @brief Create @p slotCount slots of @p initialIndices indices each.
+         * @throws std::runtime_error on Vulkan/VMA errors.
+         */
+        void create(VmaAllocator allocator, VkDevice device, uint32_t slotCount, std::size_t initialIndices = 1u << 16);
+
+        /// Destroy all slots (safe to call multiple times).
+        void destroy() noexcept;
+
+        /**
+         * @brief Mapped room for @p indexCount indices at the start of @p slot (grows the slot if needed).
+         * @throws std::runtime_error on Vulkan/VMA errors or a bad slot.
+         *
+         * Pointers from an earlier reserve() of the same slot are invalidated.
+         */
+        [[nodiscard]] uint32_t *reserve(uint32_t slot, std::size_t indexCount);
+
+        /// Make the first @p indexCount written indices of @p slot visible to the device (no-op on coherent memory).
+        void flush(uint32_t slot, std::size_t indexCount) const;
+
+        [[nodiscard]] VkBuffer buffer(uint32_t slot) const noexcept
+        {
+            return slot < slots_.size() ? slots_[slot].get() : VK_NULL_HANDLE;
+        }
+        [[nodiscard]] uint32_t slotCount() const noexcept { return static_cast<uint32_t>(slots_.size()); }
+        /// Sum of all slot sizes in bytes.
+        [[nodiscard]] VkDeviceSize capacityBytes() const noexcept;
+
+    private:
+        void createSlot(uint32_t slot, std::size_t indexCount);
+
+        VmaAllocator allocator_{VK_NULL_HANDLE};
+        VkDevice device_{VK_NULL_HANDLE};
+        std::vector<Buffer> slots_;
+    };
+
+} // namespace Vk::Gfx
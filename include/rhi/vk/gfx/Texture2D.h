@@ -1,8 +1,11 @@
 #pragma once
 #include <vulkan/vulkan.h>
+#include <cstdint>
 #include <string>
 #include <vk_mem_alloc.h>
 
+#include "rhi/vk/UploadContext.h"
+
 namespace Vk::Gfx
 {
     /**
@@ -10,17 +13,16 @@ namespace Vk::Gfx
      * and destruction using Vulkan Memory Allocator (VMA).
      *
      * Provides helpers for both direct RGBA8 data upload and file-based loading
-     * via stb_image (if OME3D_USE_STB is defined).
+     * via stb_image (if OME3D_USE_STB is defined). Samplers are not created per
+     * texture: the owner assigns a shared one with setSampler() (see SamplerCache).
      */
     class Texture2D
     {
     public:
         /**
          * @brief Create a 2D texture directly from raw RGBA8 pixel data.
-         * @param allocator   The VMA allocator used for GPU memory.
-         * @param device      The logical Vulkan device.
-         * @param cmdPool     A command pool from the graphics queue family.
-         * @param graphicsQueue Graphics queue used for copy and layout transitions.
+         * @param upload      Upload batch that receives the copy, transitions and mip blits;
+         *                    the texture is sampleable once that batch has completed.
          * @param pixels      Pointer to raw pixel data (4 bytes per pixel, row-major).
          * @param w, h        Image dimensions in pixels.
          * @param generateMips Whether to generate mipmaps on the GPU.
@@ -49,6 +51,7 @@ namespace Vk::Gfx
                 width_ = other.width_;
                 height_ = other.height_;
                 mipLevels_ = other.mipLevels_;
+                swizzle_ = other.swizzle_;
 
                 other.device_ = VK_NULL_HANDLE;
                 other.allocator_ = VK_NULL_HANDLE;
@@ -60,15 +63,13 @@ namespace Vk::Gfx
                 other.width_ = 0;
                 other.height_ = 0;
                 other.mipLevels_ = 1;
+                other.swizzle_ = {};
             }
             return *this;
         }
 
         void createFromRGBA8(
-            VmaAllocator allocator,
-            VkDevice device,
-            VkCommandPool cmdPool,
-            VkQueue graphicsQueue,
+            UploadContext &upload,
             const void *pixels,
             uint32_t w,
             uint32_t h,
@@ -76,14 +77,43 @@ namespace Vk::Gfx
             VkFormat format = VK_FORMAT_R8G8B8A8_UNORM,
             const char *debugName = nullptr);
 
+        /**
+         * @brief Like createFromRGBA8() for any uncompressed 8-bit format (R8, R8G8, RGBA8):
+         *        @p pixels holds tightly packed texels of blockInfo(@p format) bytes.
+         * @param swizzle View component mapping (e.g. move a two-channel map to where the shader reads it).
+         */
+        void createFromPixels(
+            UploadContext &upload,
+            const void *pixels,
+            uint32_t w,
+            uint32_t h,
+            bool generateMips,
+            VkFormat format,
+            const char *debugName = nullptr,
+            VkComponentMapping swizzle = {});
+
+        /**
+         * @brief Create a texture from a prebuilt mip chain (e.g. a cooked, block-compressed file).
+         *        All levels are staged and copied in one go; no blits, no TRANSFER_SRC usage.
+         * @param levels      levelCount mips, largest first (level i -> mip i), offsets into @p data.
+         * @param format      Any format covered by blockInfo() (R8/RG8/RGBA8, BC4/BC5/BC7).
+         */
+        void createFromLevels(
+            UploadContext &upload,
+            const void *data,
+            const UploadContext::ImageLevel *levels,
+            uint32_t levelCount,
+            uint32_t w,
+            uint32_t h,
+            VkFormat format,
+            const char *debugName = nullptr,
+            VkComponentMapping swizzle = {});
+
         /**
          * @brief Load texture from an image file using stb_image (requires OME3D_USE_STB).
          */
         void loadFromFile(
-            VmaAllocator allocator,
-            VkDevice device,
-            VkCommandPool cmdPool,
-            VkQueue graphicsQueue,
+            UploadContext &upload,
             const std::string &path,
             bool genMips,
             VkFormat fmt = VK_FORMAT_R8G8B8A8_UNORM);
@@ -94,6 +124,9 @@ namespace Vk::Gfx
          */
         void destroy();
 
+        /// Sampler to bind with this texture (not owned; typically shared through a SamplerCache).
+        void setSampler(VkSampler sampler) noexcept { sampler_ = sampler; }
+
         // --- Getters ---
         VkImageView view() const { return imageView_; }
         VkSampler sampler() const { return sampler_; }
@@ -102,15 +135,18 @@ namespace Vk::Gfx
         uint32_t height() const { return height_; }
         uint32_t mipLevels() const { return mipLevels_; }
 
+        /// GPU bytes of the image including every mip (texel data only, no alignment padding).
+        uint64_t sizeBytes() const;
+
+        /// Texel block of @p format: edge in texels and bytes per block (1 x 4 for RGBA8, 1 x 1 for R8); false if unknown.
+        static bool blockInfo(VkFormat format, uint32_t &blockDim, uint32_t &blockBytes);
+
     private:
         // --- Internal helpers ---
-        VkCommandBuffer beginOneTimeCommands(VkDevice device, VkCommandPool pool);
-        void endOneTimeCommands(VkDevice device, VkQueue queue, VkCommandPool pool, VkCommandBuffer cmd);
         void transition(VkCommandBuffer cmd, VkImageLayout oldLayout, VkImageLayout newLayout,
                         uint32_t baseMip, uint32_t mipCount);
         void createImageView();
-        void createSampler();
-        void generateMipmaps(VkCommandPool pool, VkQueue queue);
+        void generateMipmaps(VkCommandBuffer cmd);
 
         // --- Resource state ---
         VkDevice device_ = VK_NULL_HANDLE;
@@ -118,11 +154,12 @@ namespace Vk::Gfx
         VkImage image_ = VK_NULL_HANDLE;
         VmaAllocation imageAlloc_ = VK_NULL_HANDLE;
         VkImageView imageView_ = VK_NULL_HANDLE;
-        VkSampler sampler_ = VK_NULL_HANDLE;
+        VkSampler sampler_ = VK_NULL_HANDLE; // not owned
         VkFormat format_ = VK_FORMAT_UNDEFINED;
         uint32_t width_ = 0;
         uint32_t height_ = 0;
         uint32_t mipLevels_ = 1;
+        VkComponentMapping swizzle_{}; // identity
     };
 
 } // namespace Vk::Gfx
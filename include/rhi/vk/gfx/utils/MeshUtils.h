@@ -5,6 +5,7 @@
 #include <glm/vec3.hpp>
 
 #include "rhi/vk/gfx/Mesh.h"     // needs getMin()/getMax()/getLocalTransform()
+#include "rhi/vk/gfx/DrawItem.h"
 #include "core/math/MathUtils.h" // Core::MathUtils::{AABB, expandAABBByMat4}
 
 namespace Vk::Gfx::Utils
@@ -33,4 +34,26 @@ namespace Vk::Gfx::Utils
         return AABB{mn, mx};
     }
 
+    /**
+     * @brief Compute a world-space AABB for a draw list (mesh local AABB x item transform).
+     */
+    [[nodiscard]] inline Core::MathUtils::AABB
+    computeWorldAABB(const std::vector<Vk::Gfx::DrawItem> &items) noexcept
+    {
+        using Core::MathUtils::AABB;
+        using Core::MathUtils::expandAABBByMat4;
+
+        glm::vec3 mn(std::numeric_limits<float>::infinity());
+        glm::vec3 mx(-std::numeric_limits<float>::infinity());
+
+        for (const Vk::Gfx::DrawItem &it : items)
+        {
+            if (!it.mesh)
+                continue;
+            expandAABBByMat4(it.mesh->getMin(), it.mesh->getMax(), it.transform, mn, mx);
+        }
+
+        return AABB{mn, mx};
+    }
+
 } // namespace Vk::Gfx::Utils
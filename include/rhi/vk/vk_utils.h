@@ -21,9 +21,3 @@ inline VkFormat FindSupportedDepthFormat(VkPhysicalDevice physicalDevice)
     }
     throw std::runtime_error("No supported depth format");
 }
-
-struct PushPC
-{
-    glm::mat4 model;
-    glm::mat4 normalMatrix;
-};
\ No newline at end of file
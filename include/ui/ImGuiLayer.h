@@ -6,9 +6,16 @@
 namespace Vk
 {
     struct RendererContext;
+    struct RecordStats;
     class VulkanAllocator;
 }
 
+namespace Render
+{
+    class DrawListBuilder;
+    struct TextureCacheStats;
+}
+
 namespace Platform
 {
     class WindowManager;
@@ -42,7 +49,11 @@ namespace UI
         // Ends the frame and records ImGui draw commands into a Vulkan command buffer.
         void render(VkCommandBuffer cmd);
 
-        void drawVmaPanel(Vk::VulkanAllocator &allocator);
+        // Heap budgets/usage, VMA JSON dump and texture/material cache sharing.
+        void drawVmaPanel(Vk::VulkanAllocator &allocator, const Render::TextureCacheStats &textureCache);
+
+        // Draw-list settings (LOD selection), per-frame triangle savings and recorder bind counts.
+        void drawRenderPanel(Render::DrawListBuilder &drawList, const Vk::RecordStats &recording);
 
         // Recreates ImGui Vulkan resources (e.g., on swapchain resize)
         void onSwapchainRecreate();
@@ -1,7 +1,6 @@
 #version 450
 
 // — стабильные значения —
-const float NORMAL_MIP_BIAS = 1.25;   // было так, когда «дрожь» ушла
 const float NORMAL_SCALE    = 0.50;   // приглушаем нормаль
 const float ALBEDO_MIP_BIAS = 0.25;   // мягкая фильтрация альбедо
 
@@ -20,7 +19,7 @@ layout(std140, set=0, binding=0) uniform ViewUBO {
 
 // set=1
 layout(set=1, binding=0) uniform sampler2D uBaseColor; // sRGB
-layout(set=1, binding=1) uniform sampler2D uNormal;    // UNORM
+layout(set=1, binding=1) uniform sampler2D uNormal;    // UNORM, RG = XY (Z rebuilt in normalFromMap), B = Toksvig variance
 layout(set=1, binding=2) uniform sampler2D uMR;        // UNORM (MR или ARM)
 layout(set=1, binding=3) uniform sampler2D uAO;        // UNORM (если не ARM)
 layout(set=1, binding=4) uniform sampler2D uEmissive;  // sRGB
@@ -52,7 +51,8 @@ vec3 normalFromMap(vec2 uv, vec3 Nws, vec3 Tws, float btSign){
     vec3 T = normalize(Tws);
     vec3 B = normalize(btSign * cross(N, T));
 
-    vec3 n = texture(uNormal, uv).xyz * 2.0 - 1.0;
+    vec3 n;
+    n.xy  = texture(uNormal, uv).xy * 2.0 - 1.0;
     n.xy *= NORMAL_SCALE;
     n.z   = sqrt(max(0.0, 1.0 - dot(n.xy, n.xy)));
 
@@ -111,12 +111,12 @@ void main(){
     vec3 V = normalize(uView.cameraPos.xyz - vPosWS);
     float NdotV = max(dot(N, V), 0.0);
 
-    // Specular AA (только Toksvig по мипу нормали)
-    float lodN   = NORMAL_MIP_BIAS;
-    vec3  nAvg   = textureLod(uNormal, uv, lodN).xyz * 2.0 - 1.0;
-    float lenAvg = clamp(length(nAvg), 1e-3, 1.0);
-    float sigma2 = max((1.0 / lenAvg) - 1.0, 0.0);
-    a = sqrt(a*a + sigma2);
+    // Specular AA (Toksvig): RG only hold a direction, so the shortening of the averaged normal
+    // (1/|n| - 1) is baked per mip at cook time into B (CookNormalMap; 0 for uncooked maps)
+    if ((uMat.flags & 2u) != 0u) {
+        float sigma2 = texture(uNormal, uv).b;
+        a = sqrt(a*a + sigma2);
+    }
 
     vec3 F0 = mix(vec3(0.04), albedo, metallic);
     vec3 Lo = vec3(0.0);
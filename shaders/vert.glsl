@@ -1,5 +1,7 @@
 #version 450
 
+// Compiled to vert.spv by the build (glslc, see CMakeLists.txt).
+
 layout(location=0) in vec3 inPos;
 layout(location=1) in vec3 inNormal;
 layout(location=2) in vec2 inUV;
@@ -12,7 +14,13 @@ layout(std140, set=0, binding=0) uniform ViewUBO {
     vec4 cameraPos;
 } uView;
 
-layout(push_constant) uniform PushConsts { mat4 model; } pc;
+// Per-object data for this frame (Render::ObjectData), indexed by gl_InstanceIndex
+// (a draw's firstInstance + instance)
+struct ObjectData {
+    mat4 model;
+    mat4 normalMatrix; // inverse-transpose of mat3(model), precomputed on the CPU
+};
+layout(std430, set=0, binding=1) readonly buffer ObjectBuffer { ObjectData objects[]; } uObjects;
 
 layout(location=0) out vec2  vUV;
 layout(location=1) out vec3  vPosWS;
@@ -21,8 +29,8 @@ layout(location=3) out vec3  vTangentWS;
 layout(location=4) out float vBtSign;
 
 void main() {
-    mat3 nrmMat = transpose(inverse(mat3(pc.model)));
-    vec4 posWS  = pc.model * vec4(inPos, 1.0);
+    mat3 nrmMat = mat3(uObjects.objects[gl_InstanceIndex].normalMatrix);
+    vec4 posWS  = uObjects.objects[gl_InstanceIndex].model * vec4(inPos, 1.0);
 
     vUV        = inUV;
     vPosWS     = posWS.xyz;
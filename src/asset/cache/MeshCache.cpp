@@ -0,0 +1,392 @@
+#include "asset/cache/MeshCache.h"
+
+#include "core/Hash.h"
+#include "core/Logger.h"
+
+#include <cgltf.h>
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <system_error>
+
+namespace Asset
+{
+    namespace
+    {
+        constexpr std::array<char, 8> kMagic{'O', 'M', 'E', 'M', 'E', 'S', 'H', '\0'};
+        constexpr std::uint64_t kDataAlignment = 16;
+
+        struct FileHeader
+        {
+            std::array<char, 8> magic;
+            std::uint32_t version;
+            std::uint32_t meshCount;
+            std::uint64_t key;
+            std::uint64_t fileSize;
+            std::uint32_t instanceCount;
+            std::uint32_t reserved;
+            std::uint64_t instancesOffset; // bytes from file start
+        };
+
+        struct StreamRange
+        {
+            std::uint64_t offset; // bytes from file start
+            std::uint64_t count;  // elements (floats / indices)
+        };
+
+        struct MeshRecord
+        {
+            float localTransform[16];
+            StreamRange positions;
+            StreamRange normals;
+            StreamRange texcoords;
+            StreamRange tangents;
+            StreamRange indices;
+            StreamRange lods;
+            StreamRange meshlets;
+        };
+
+        struct InstanceRecord
+        {
+            std::uint32_t meshIndex;
+            std::uint32_t reserved;
+            float transform[16];
+        };
+
+        static_assert(sizeof(FileHeader) == 48, "MeshCache header layout changed; bump kFormatVersion");
+        static_assert(sizeof(MeshRecord) == 176, "MeshCache record layout changed; bump kFormatVersion");
+        static_assert(sizeof(InstanceRecord) == 72, "MeshCache instance layout changed; bump kFormatVersion");
+        static_assert(sizeof(MeshLod) == 12, "MeshLod is stored verbatim; bump kFormatVersion");
+        static_assert(sizeof(Meshlet) == 40, "Meshlet is stored verbatim; bump kFormatVersion");
+
+        std::uint64_t alignUp(std::uint64_t v) noexcept
+        {
+            return (v + kDataAlignment - 1) & ~(kDataAlignment - 1);
+        }
+
+        /// Validate a stream range against the mapped file and return it as a span.
+        template <typename T>
+        bool viewRange(const Core::IO::MappedFile &file, const StreamRange &r, std::span<const T> &out) noexcept
+        {
+            if (r.count == 0)
+            {
+                out = {};
+                return true;
+            }
+            if (r.offset % alignof(T) != 0 || r.offset > file.size())
+                return false;
+            const std::uint64_t available = (file.size() - r.offset) / sizeof(T);
+            if (r.count > available)
+                return false;
+
+            out = std::span<const T>(reinterpret_cast<const T *>(file.data() + r.offset),
+                                     static_cast<std::size_t>(r.count));
+            return true;
+        }
+
+        /// Hash the external buffers referenced by a .gltf (JSON) file.
+        /// .glb embeds its BIN chunk, so hashing the file itself already covers it.
+        bool hashExternalBuffers(const std::string &sourcePath,
+                                 const Core::IO::MappedFile &source,
+                                 std::uint64_t &key)
+        {
+            cgltf_options options{};
+            cgltf_data *data = nullptr;
+            if (cgltf_parse(&options, source.data(), source.size(), &data) != cgltf_result_success)
+                return false;
+
+            const std::filesystem::path baseDir = std::filesystem::path(sourcePath).parent_path();
+            bool ok = true;
+
+            for (cgltf_size i = 0; i < data->buffers_count && ok; ++i)
+            {
+                const char *uri = data->buffers[i].uri;
+                if (!uri || std::strncmp(uri, "data:", 5) == 0)
+                    continue; // GLB chunk or embedded base64 (already part of the JSON bytes)
+
+                std::string decoded(uri);
+                decoded.resize(cgltf_decode_uri(decoded.data()));
+
+                Core::IO::MappedFile buffer;
+                if (!buffer.open((baseDir / decoded).string()))
+                {
+                    ok = false;
+                    break;
+                }
+                key = Core::Hash::hash64(buffer.data(), buffer.size(), key);
+            }
+
+            cgltf_free(data);
+            return ok;
+        }
+
+    } // namespace
+
+    MeshCache::MeshCache(std::filesystem::path directory)
+        : directory_(std::move(directory))
+    {
+    }
+
+    std::filesystem::path MeshCache::entryPath(std::uint64_t key) const
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.omesh", static_cast<unsigned long long>(key));
+        return directory_ / name;
+    }
+
+    std::optional<std::uint64_t> MeshCache::computeKey(const std::string &sourcePath,
+                                                       const Processing::OptimizeSettings &settings)
+    {
+        Core::IO::MappedFile source;
+        if (!source.open(sourcePath))
+            return std::nullopt;
+
+        // 1) Source bytes (+ external buffers for .gltf)
+        std::uint64_t key = Core::Hash::hash64(source.data(), source.size(), kFormatVersion);
+
+        const bool isGlb = source.size() >= 4 && std::memcmp(source.data(), "glTF", 4) == 0;
+        if (!isGlb && !hashExternalBuffers(sourcePath, source, key))
+            return std::nullopt;
+
+        // 2) Processing settings (field by field: struct padding must not leak into the key)
+        key = Core::Hash::combine(key, settings.optimizeOverdraw);
+        key = Core::Hash::combine(key, settings.overdrawThreshold);
+        key = Core::Hash::combine(key, settings.optimizeFetch);
+        key = Core::Hash::combine(key, settings.optimizeCache);
+        key = Core::Hash::combine(key, settings.simplify);
+        key = Core::Hash::combine(key, settings.simplifyTargetRatio);
+        key = Core::Hash::combine(key, settings.simplifyError);
+        key = Core::Hash::combine(key, settings.generateLods);
+        key = Core::Hash::combine(key, settings.lod.maxLevels);
+        key = Core::Hash::combine(key, settings.lod.reductionRatio);
+        key = Core::Hash::combine(key, settings.lod.maxStepError);
+        key = Core::Hash::combine(key, settings.lod.minTriangles);
+        key = Core::Hash::combine(key, settings.lod.minReduction);
+        key = Core::Hash::combine(key, settings.buildMeshlets);
+        key = Core::Hash::combine(key, settings.meshlet.maxVertices);
+        key = Core::Hash::combine(key, settings.meshlet.maxTriangles);
+        key = Core::Hash::combine(key, settings.meshlet.coneWeight);
+        return key;
+    }
+
+    std::optional<CachedMeshes> MeshCache::load(std::uint64_t key) const
+    {
+        const std::filesystem::path path = entryPath(key);
+
+        std::error_code ec;
+        if (!std::filesystem::exists(path, ec))
+            return std::nullopt;
+
+        CachedMeshes result;
+        if (!result.file_.open(path.string()))
+            return std::nullopt;
+
+        const auto &file = result.file_;
+        auto reject = [&](const char *why) -> std::optional<CachedMeshes>
+        {
+            CORE_LOG_WARN("MeshCache: ignoring '" + path.string() + "': " + why);
+            return std::nullopt;
+        };
+
+        // 1) Header
+        if (file.size() < sizeof(FileHeader))
+            return reject("truncated header");
+
+        FileHeader header{};
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (header.magic != kMagic)
+            return reject("bad magic");
+        if (header.version != kFormatVersion)
+            return reject("format version mismatch");
+        if (header.key != key)
+            return reject("key mismatch");
+        if (header.fileSize != file.size())
+            return reject("size mismatch (partial write?)");
+
+        const std::uint64_t recordsBytes = std::uint64_t(header.meshCount) * sizeof(MeshRecord);
+        if (recordsBytes > file.size() - sizeof(FileHeader))
+            return reject("truncated mesh table");
+
+        // 2) Mesh table -> views into the mapping
+        result.meshes_.reserve(header.meshCount);
+        const std::uint8_t *records = file.data() + sizeof(FileHeader);
+
+        for (std::uint32_t i = 0; i < header.meshCount; ++i)
+        {
+            MeshRecord rec{};
+            std::memcpy(&rec, records + i * sizeof(MeshRecord), sizeof(rec));
+
+            MeshDataView view;
+            std::memcpy(&view.localTransform[0][0], rec.localTransform, sizeof(rec.localTransform));
+
+            if (!viewRange(file, rec.positions, view.positions) ||
+                !viewRange(file, rec.normals, view.normals) ||
+                !viewRange(file, rec.texcoords, view.texcoords) ||
+                !viewRange(file, rec.tangents, view.tangents) ||
+                !viewRange(file, rec.indices, view.indices) ||
+                !viewRange(file, rec.lods, view.lods) ||
+                !viewRange(file, rec.meshlets, view.meshlets))
+                return reject("stream out of range");
+
+            for (const MeshLod &lod : view.lods)
+                if (lod.firstIndex > view.indices.size() || lod.indexCount > view.indices.size() - lod.firstIndex)
+                    return reject("LOD range out of bounds");
+
+            const std::size_t baseCount = view.baseIndexCount();
+            for (const Meshlet &m : view.meshlets)
+                if (m.firstIndex > baseCount || m.indexCount > baseCount - m.firstIndex)
+                    return reject("meshlet range out of bounds");
+
+            result.meshes_.push_back(view);
+        }
+
+        // 3) Instance table (small; copied out of the mapping)
+        const std::uint64_t instanceBytes = std::uint64_t(header.instanceCount) * sizeof(InstanceRecord);
+        if (header.instancesOffset > file.size() || instanceBytes > file.size() - header.instancesOffset)
+            return reject("truncated instance table");
+
+        result.instances_.resize(header.instanceCount);
+        for (std::uint32_t i = 0; i < header.instanceCount; ++i)
+        {
+            InstanceRecord rec{};
+            std::memcpy(&rec, file.data() + header.instancesOffset + i * sizeof(InstanceRecord), sizeof(rec));
+            if (rec.meshIndex >= header.meshCount)
+                return reject("instance references a missing mesh");
+
+            result.instances_[i].meshIndex = rec.meshIndex;
+            std::memcpy(&result.instances_[i].transform[0][0], rec.transform, sizeof(rec.transform));
+        }
+
+        return result;
+    }
+
+    bool MeshCache::store(std::uint64_t key, const ModelData &model) const
+    {
+        const std::vector<MeshData> &meshes = model.meshes;
+        if (meshes.size() > std::numeric_limits<std::uint32_t>::max() ||
+            model.instances.size() > std::numeric_limits<std::uint32_t>::max())
+            return false;
+
+        std::error_code ec;
+        std::filesystem::create_directories(directory_, ec);
+        if (ec)
+        {
+            CORE_LOG_WARN("MeshCache: can't create '" + directory_.string() + "': " + ec.message());
+            return false;
+        }
+
+        // 1) Layout: header | mesh table | instance table | 16-byte aligned streams
+        std::vector<MeshRecord> table(meshes.size());
+        std::vector<InstanceRecord> instances(model.instances.size());
+
+        const std::uint64_t instancesOffset = sizeof(FileHeader) + table.size() * sizeof(MeshRecord);
+        std::uint64_t cursor = alignUp(instancesOffset + instances.size() * sizeof(InstanceRecord));
+
+        for (std::size_t i = 0; i < instances.size(); ++i)
+        {
+            instances[i].meshIndex = model.instances[i].meshIndex;
+            instances[i].reserved = 0;
+            std::memcpy(instances[i].transform, &model.instances[i].transform[0][0], sizeof(instances[i].transform));
+        }
+
+        auto place = [&cursor](std::size_t count, std::size_t elemSize)
+        {
+            StreamRange r{count ? cursor : 0, count};
+            cursor = alignUp(cursor + std::uint64_t(count) * elemSize);
+            return r;
+        };
+
+        for (std::size_t i = 0; i < meshes.size(); ++i)
+        {
+            const MeshData &md = meshes[i];
+            MeshRecord &rec = table[i];
+            std::memcpy(rec.localTransform, &md.localTransform[0][0], sizeof(rec.localTransform));
+            rec.positions = place(md.positions.size(), sizeof(float));
+            rec.normals = place(md.normals.size(), sizeof(float));
+            rec.texcoords = place(md.texcoords.size(), sizeof(float));
+            rec.tangents = place(md.tangents.size(), sizeof(float));
+            rec.indices = place(md.indices.size(), sizeof(MeshData::Index));
+            rec.lods = place(md.lods.size(), sizeof(MeshLod));
+            rec.meshlets = place(md.meshlets.size(), sizeof(Meshlet));
+        }
+
+        FileHeader header{kMagic, kFormatVersion, static_cast<std::uint32_t>(meshes.size()), key, cursor,
+                          static_cast<std::uint32_t>(instances.size()), 0, instancesOffset};
+
+        // 2) Write to a temp file, then move into place so readers never see partial entries
+        const std::filesystem::path finalPath = entryPath(key);
+        std::filesystem::path tmpPath = finalPath;
+        tmpPath += ".tmp";
+
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out)
+            {
+                CORE_LOG_WARN("MeshCache: can't open '" + tmpPath.string() + "' for writing");
+                return false;
+            }
+
+            std::uint64_t written = 0;
+            auto writeBytes = [&](const void *src, std::size_t bytes)
+            {
+                out.write(static_cast<const char *>(src), static_cast<std::streamsize>(bytes));
+                written += bytes;
+            };
+            auto padTo = [&](std::uint64_t offset)
+            {
+                static const char zeros[kDataAlignment]{};
+                if (offset > written)
+                    writeBytes(zeros, static_cast<std::size_t>(offset - written));
+            };
+
+            writeBytes(&header, sizeof(header));
+            writeBytes(table.data(), table.size() * sizeof(MeshRecord));
+            writeBytes(instances.data(), instances.size() * sizeof(InstanceRecord));
+
+            for (std::size_t i = 0; i < meshes.size(); ++i)
+            {
+                const MeshData &md = meshes[i];
+                const MeshRecord &rec = table[i];
+
+                auto writeStream = [&](const StreamRange &r, const void *src, std::size_t elemSize)
+                {
+                    if (r.count == 0)
+                        return;
+                    padTo(r.offset);
+                    writeBytes(src, static_cast<std::size_t>(r.count) * elemSize);
+                };
+
+                writeStream(rec.positions, md.positions.data(), sizeof(float));
+                writeStream(rec.normals, md.normals.data(), sizeof(float));
+                writeStream(rec.texcoords, md.texcoords.data(), sizeof(float));
+                writeStream(rec.tangents, md.tangents.data(), sizeof(float));
+                writeStream(rec.indices, md.indices.data(), sizeof(MeshData::Index));
+                writeStream(rec.lods, md.lods.data(), sizeof(MeshLod));
+                writeStream(rec.meshlets, md.meshlets.data(), sizeof(Meshlet));
+            }
+            padTo(cursor);
+
+            if (!out)
+            {
+                CORE_LOG_WARN("MeshCache: write failed for '" + tmpPath.string() + "'");
+                out.close();
+                std::filesystem::remove(tmpPath, ec);
+                return false;
+            }
+        }
+
+        std::filesystem::remove(finalPath, ec); // rename() doesn't replace on every platform
+        std::filesystem::rename(tmpPath, finalPath, ec);
+        if (ec)
+        {
+            CORE_LOG_WARN("MeshCache: can't move entry into place: " + ec.message());
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Asset
@@ -0,0 +1,285 @@
+#include "asset/cache/TextureCookCache.h"
+
+#include "core/Hash.h"
+#include "core/Logger.h"
+#include "core/io/MappedFile.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+namespace Asset
+{
+    namespace
+    {
+        constexpr std::array<char, 8> kMagic{'O', 'M', 'E', 'T', 'E', 'X', '\0', '\0'};
+        constexpr std::uint64_t kDataAlignment = 16;
+        constexpr std::uint32_t kMaxLevels = 16;
+
+        struct FileHeader
+        {
+            std::array<char, 8> magic;
+            std::uint32_t version;
+            std::uint32_t codec;
+            std::uint32_t srgb;
+            std::uint32_t width;
+            std::uint32_t height;
+            std::uint32_t levelCount;
+            std::uint32_t tag;
+            std::uint32_t reserved;
+            std::uint64_t key;
+            std::uint64_t fileSize;
+            std::uint64_t dataOffset; // bytes from file start; level offsets are relative to it
+        };
+
+        struct LevelRecord
+        {
+            std::uint64_t offset;
+            std::uint64_t bytes;
+            std::uint32_t width;
+            std::uint32_t height;
+        };
+
+        static_assert(sizeof(FileHeader) == 64, "TextureCookCache header layout changed; bump kFormatVersion");
+        static_assert(sizeof(LevelRecord) == 24, "TextureCookCache level layout changed; bump kFormatVersion");
+
+        std::uint64_t alignUp(std::uint64_t v) noexcept
+        {
+            return (v + kDataAlignment - 1) & ~(kDataAlignment - 1);
+        }
+
+        /// Bytes a level of @p w x @p h texels occupies in @p codec.
+        std::uint64_t levelBytes(Processing::TextureCodec codec, std::uint32_t w, std::uint32_t h) noexcept
+        {
+            const std::uint64_t dim = Processing::CodecBlockDim(codec);
+            return ((w + dim - 1) / dim) * ((h + dim - 1) / dim) * Processing::CodecBlockBytes(codec);
+        }
+
+    } // namespace
+
+    TextureCookCache::TextureCookCache(std::filesystem::path directory)
+        : directory_(std::move(directory))
+    {
+    }
+
+    std::filesystem::path TextureCookCache::entryPath(std::uint64_t key) const
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.oktx", static_cast<unsigned long long>(key));
+        return directory_ / name;
+    }
+
+    std::optional<std::uint64_t> TextureCookCache::computeKey(std::span<const std::string> sources,
+                                                              Processing::TextureCodec codec, bool srgb,
+                                                              std::uint64_t variant) const
+    {
+        std::uint64_t key = Core::Hash::hash64(nullptr, 0, kFormatVersion);
+
+        // 1) Source bytes (memoized while size + mtime are unchanged)
+        for (const std::string &path : sources)
+        {
+            std::error_code ec;
+            const std::uintmax_t size = std::filesystem::file_size(path, ec);
+            if (ec)
+                return std::nullopt;
+            const auto mtime = std::filesystem::last_write_time(path, ec);
+            if (ec)
+                return std::nullopt;
+
+            SourceHash &memo = sourceHashes_[path];
+            if (memo.hash == 0 || memo.size != size || memo.mtime != mtime)
+            {
+                Core::IO::MappedFile file;
+                if (!file.open(path))
+                {
+                    sourceHashes_.erase(path);
+                    return std::nullopt;
+                }
+                memo = SourceHash{size, mtime, Core::Hash::hash64(file.data(), file.size(), 0) | 1};
+            }
+            key = Core::Hash::combine(key, memo.hash);
+        }
+
+        // 2) How the sources are turned into texels
+        key = Core::Hash::combine(key, static_cast<std::uint32_t>(codec));
+        key = Core::Hash::combine(key, srgb);
+        key = Core::Hash::combine(key, variant);
+        return key;
+    }
+
+    bool TextureCookCache::contains(std::uint64_t key, std::uint32_t *tag) const
+    {
+        const std::filesystem::path path = entryPath(key);
+
+        std::error_code ec;
+        const std::uintmax_t size = std::filesystem::file_size(path, ec);
+        if (ec)
+            return false;
+
+        FileHeader header{};
+        std::ifstream in(path, std::ios::binary);
+        if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)))
+            return false;
+        if (header.magic != kMagic || header.version != kFormatVersion || header.key != key ||
+            header.fileSize != size)
+            return false;
+
+        if (tag)
+            *tag = header.tag;
+        return true;
+    }
+
+    std::optional<Processing::CookedTexture> TextureCookCache::load(std::uint64_t key) const
+    {
+        const std::filesystem::path path = entryPath(key);
+
+        std::error_code ec;
+        if (!std::filesystem::exists(path, ec))
+            return std::nullopt;
+
+        Core::IO::MappedFile file;
+        if (!file.open(path.string()))
+            return std::nullopt;
+
+        auto reject = [&](const char *why) -> std::optional<Processing::CookedTexture>
+        {
+            CORE_LOG_WARN("TextureCookCache: ignoring '" + path.string() + "': " + why);
+            return std::nullopt;
+        };
+
+        // 1) Header
+        if (file.size() < sizeof(FileHeader))
+            return reject("truncated header");
+
+        FileHeader header{};
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (header.magic != kMagic)
+            return reject("bad magic");
+        if (header.version != kFormatVersion)
+            return reject("format version mismatch");
+        if (header.key != key)
+            return reject("key mismatch");
+        if (header.fileSize != file.size())
+            return reject("size mismatch (partial write?)");
+        if (header.codec > static_cast<std::uint32_t>(Processing::TextureCodec::R8))
+            return reject("unknown codec");
+        if (header.levelCount == 0 || header.levelCount > kMaxLevels || header.width == 0 || header.height == 0)
+            return reject("bad extent");
+        if (header.dataOffset < sizeof(FileHeader) + header.levelCount * sizeof(LevelRecord) ||
+            header.dataOffset > file.size())
+            return reject("truncated level index");
+
+        Processing::CookedTexture tex;
+        tex.codec = static_cast<Processing::TextureCodec>(header.codec);
+        tex.srgb = header.srgb != 0;
+        tex.width = header.width;
+        tex.height = header.height;
+        tex.tag = header.tag;
+
+        // 2) Level index: each level must have the exact size its extent implies
+        const std::uint64_t dataBytes = file.size() - header.dataOffset;
+        tex.levels.resize(header.levelCount);
+        for (std::uint32_t i = 0; i < header.levelCount; ++i)
+        {
+            LevelRecord rec{};
+            std::memcpy(&rec, file.data() + sizeof(FileHeader) + i * sizeof(LevelRecord), sizeof(rec));
+
+            if (rec.width != std::max(1u, header.width >> i) || rec.height != std::max(1u, header.height >> i))
+                return reject("level extent mismatch");
+            if (rec.bytes != levelBytes(tex.codec, rec.width, rec.height))
+                return reject("level size mismatch");
+            if (rec.offset > dataBytes || rec.bytes > dataBytes - rec.offset)
+                return reject("level out of range");
+
+            tex.levels[i] = Processing::CookedLevel{rec.offset, rec.bytes, rec.width, rec.height};
+        }
+
+        // 3) Payload (copied: the mapping closes with this function)
+        tex.data.assign(file.data() + header.dataOffset, file.data() + file.size());
+        return tex;
+    }
+
+    bool TextureCookCache::store(std::uint64_t key, const Processing::CookedTexture &texture) const
+    {
+        if (texture.levels.empty() || texture.levels.size() > kMaxLevels)
+            return false;
+
+        std::error_code ec;
+        std::filesystem::create_directories(directory_, ec);
+        if (ec)
+        {
+            CORE_LOG_WARN("TextureCookCache: can't create '" + directory_.string() + "': " + ec.message());
+            return false;
+        }
+
+        // 1) Layout: header | level index | 16-byte aligned payload (levels as cooked)
+        std::vector<LevelRecord> index(texture.levels.size());
+        for (std::size_t i = 0; i < index.size(); ++i)
+        {
+            const Processing::CookedLevel &l = texture.levels[i];
+            index[i] = LevelRecord{l.offset, l.bytes, l.width, l.height};
+        }
+
+        const std::uint64_t dataOffset = alignUp(sizeof(FileHeader) + index.size() * sizeof(LevelRecord));
+        const std::uint64_t fileSize = dataOffset + texture.data.size();
+
+        FileHeader header{kMagic,
+                          kFormatVersion,
+                          static_cast<std::uint32_t>(texture.codec),
+                          texture.srgb ? 1u : 0u,
+                          texture.width,
+                          texture.height,
+                          static_cast<std::uint32_t>(index.size()),
+                          texture.tag,
+                          0,
+                          key,
+                          fileSize,
+                          dataOffset};
+
+        // 2) Write to a temp file, then move into place so readers never see partial entries
+        const std::filesystem::path finalPath = entryPath(key);
+        std::filesystem::path tmpPath = finalPath;
+        tmpPath += ".tmp";
+
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out)
+            {
+                CORE_LOG_WARN("TextureCookCache: can't open '" + tmpPath.string() + "' for writing");
+                return false;
+            }
+
+            static const char zeros[kDataAlignment]{};
+            const std::uint64_t headerBytes = sizeof(FileHeader) + index.size() * sizeof(LevelRecord);
+
+            out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char *>(index.data()),
+                      static_cast<std::streamsize>(index.size() * sizeof(LevelRecord)));
+            out.write(zeros, static_cast<std::streamsize>(dataOffset - headerBytes));
+            out.write(reinterpret_cast<const char *>(texture.data.data()),
+                      static_cast<std::streamsize>(texture.data.size()));
+
+            if (!out)
+            {
+                CORE_LOG_WARN("TextureCookCache: write failed for '" + tmpPath.string() + "'");
+                out.close();
+                std::filesystem::remove(tmpPath, ec);
+                return false;
+            }
+        }
+
+        std::filesystem::remove(finalPath, ec); // rename() doesn't replace on every platform
+        std::filesystem::rename(tmpPath, finalPath, ec);
+        if (ec)
+        {
+            CORE_LOG_WARN("TextureCookCache: can't move entry into place: " + ec.message());
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Asset
@@ -1,10 +1,23 @@
 #include "asset/io/GltfLoader.h"
+#include "asset/io/IndexWidening.h"
+#include "asset/io/GltfMeshopt.h"
+#include "asset/processing/MeshAttributes.h"
 
 #include "core/Logger.h"
+#include "core/ParallelFor.h"
+#include "core/ProcessMemory.h"
+#include "core/io/MappedFile.h"
+#include "core/Stopwatch.h"
 
 #include <cgltf.h>
 #include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <optional>
 #include <string_view>
 
 #include <glm/gtc/type_ptr.hpp>
@@ -14,149 +27,382 @@
 using Core::Logger;
 using Core::LogLevel;
 
-namespace
+namespace Asset
 {
 
-    // Fill md.tangents (size = 4*V) either from geometry or leave empty if impossible.
-    static void GenerateTangents(Asset::MeshData &md)
+    // --- internal helpers (do not leak to header) ---
+    namespace
     {
-        const size_t vcount = md.positions.size() / 3;
-        if (vcount == 0 || md.indices.size() < 3)
-            return;
-        if (md.texcoords.size() != vcount * 2)
-            return; // need UVs
-        if (md.normals.size() != vcount * 3)
-            return; // need normals
-
-        std::vector<glm::vec3> T(vcount, glm::vec3(0.0f));
-        std::vector<glm::vec3> B(vcount, glm::vec3(0.0f));
-
-        auto V3 = [&](size_t i)
+
+        struct CgltfDeleter
         {
-            return glm::vec3(md.positions[3 * i + 0], md.positions[3 * i + 1], md.positions[3 * i + 2]);
+            void operator()(cgltf_data *d) const noexcept
+            {
+                if (d)
+                    cgltf_free(d);
+            }
         };
-        auto N3 = [&](size_t i)
+        using CgltfPtr = std::unique_ptr<cgltf_data, CgltfDeleter>;
+
+        /**
+         * Backing store for cgltf file callbacks: .gltf/.glb/.bin files are served from
+         * read-only mappings instead of malloc'd copies. Must outlive the cgltf_data.
+         */
+        struct MappedFileStore
         {
-            return glm::vec3(md.normals[3 * i + 0], md.normals[3 * i + 1], md.normals[3 * i + 2]);
+            std::mutex mutex;
+            std::unordered_map<const void *, Core::IO::MappedFile> files;
+
+            static cgltf_result read(const cgltf_memory_options *, const cgltf_file_options *fileOptions,
+                                     const char *path, cgltf_size *size, void **data)
+            {
+                auto *self = static_cast<MappedFileStore *>(fileOptions->user_data);
+
+                Core::IO::MappedFile file;
+                if (!file.open(path))
+                    return cgltf_result_file_not_found;
+
+                // Same contract as cgltf's default reader: *size != 0 means "expect this many bytes"
+                if (*size != 0 && *size > file.size())
+                    return cgltf_result_data_too_short;
+                if (*size == 0)
+                    *size = file.size();
+
+                file.adviseSequential();
+                *data = const_cast<std::uint8_t *>(file.data());
+
+                std::lock_guard<std::mutex> lock(self->mutex);
+                self->files.emplace(file.data(), std::move(file));
+                return cgltf_result_success;
+            }
+
+            static void release(const cgltf_memory_options *, const cgltf_file_options *fileOptions,
+                                void *data, cgltf_size)
+            {
+                auto *self = static_cast<MappedFileStore *>(fileOptions->user_data);
+                std::lock_guard<std::mutex> lock(self->mutex);
+                self->files.erase(data);
+            }
         };
-        auto UV2 = [&](size_t i)
+
+        inline bool isVecN(const cgltf_accessor *acc, cgltf_type type, int comps)
         {
-            return glm::vec2(md.texcoords[2 * i + 0], md.texcoords[2 * i + 1]);
-        };
+            return acc && acc->type == type && cgltf_num_components(acc->type) == static_cast<cgltf_size>(comps);
+        }
 
-        // accumulate per-triangle
-        for (size_t i = 0; i + 2 < md.indices.size(); i += 3)
+        /// Raw pointer to accessor data if it can be read in bulk (no sparse, in bounds), else nullptr.
+        const uint8_t *bulkAccessorData(const cgltf_accessor *accessor, cgltf_size elementSize)
         {
-            const uint32_t i0 = md.indices[i + 0];
-            const uint32_t i1 = md.indices[i + 1];
-            const uint32_t i2 = md.indices[i + 2];
+            if (accessor->is_sparse || !accessor->buffer_view || accessor->stride != elementSize)
+                return nullptr;
 
-            const glm::vec3 p0 = V3(i0), p1 = V3(i1), p2 = V3(i2);
-            const glm::vec2 w0 = UV2(i0), w1 = UV2(i1), w2 = UV2(i2);
+            const cgltf_buffer_view *view = accessor->buffer_view;
+            const uint8_t *base = cgltf_buffer_view_data(view);
+            if (!base)
+                return nullptr;
 
-            const glm::vec3 dp1 = p1 - p0;
-            const glm::vec3 dp2 = p2 - p0;
-            const glm::vec2 duv1 = w1 - w0;
-            const glm::vec2 duv2 = w2 - w0;
+            const cgltf_size bytes = accessor->count * elementSize;
+            if (accessor->offset > view->size || bytes > view->size - accessor->offset)
+                return nullptr;
 
-            const float denom = duv1.x * duv2.y - duv1.y * duv2.x;
-            if (std::abs(denom) < 1e-8f)
-                continue;
-            const float r = 1.0f / denom;
+            return base + accessor->offset;
+        }
 
-            const glm::vec3 t = (dp1 * duv2.y - dp2 * duv1.y) * r;
-            const glm::vec3 b = (dp2 * duv1.x - dp1 * duv2.x) * r;
+        void copyAttributeFloats(const cgltf_accessor *accessor, std::vector<float> &dst)
+        {
+            const cgltf_size comps = cgltf_num_components(accessor->type);
+            const cgltf_size count = accessor->count * comps;
+            dst.resize(static_cast<size_t>(count));
 
-            T[i0] += t;
-            T[i1] += t;
-            T[i2] += t;
-            B[i0] += b;
-            B[i1] += b;
-            B[i2] += b;
+            // Fast path: tightly packed float32 -> straight copy from the buffer view
+            if (accessor->component_type == cgltf_component_type_r_32f && !accessor->normalized)
+            {
+                if (const uint8_t *src = bulkAccessorData(accessor, comps * sizeof(float)))
+                {
+                    std::memcpy(dst.data(), src, static_cast<size_t>(count) * sizeof(float));
+                    return;
+                }
+            }
+
+            cgltf_accessor_unpack_floats(accessor, dst.data(), count);
         }
 
-        // orthonormalize + handedness
-        md.tangents.resize(vcount * 4);
-        for (size_t i = 0; i < vcount; ++i)
+        void copyIndices(const cgltf_accessor *accessor, std::vector<uint32_t> &dst)
         {
-            glm::vec3 n = glm::normalize(N3(i));
-            glm::vec3 t = T[i];
-            if (glm::dot(t, t) < 1e-12f)
+            const size_t count = static_cast<size_t>(accessor->count);
+            dst.resize(count);
+
+            // Fast path: contiguous u8/u16/u32 -> vectorized widening
+            const cgltf_size componentSize = cgltf_component_size(accessor->component_type);
+            if (accessor->type == cgltf_type_scalar)
+            {
+                if (const uint8_t *src = bulkAccessorData(accessor, componentSize))
+                {
+                    switch (accessor->component_type)
+                    {
+                    case cgltf_component_type_r_8u:
+                        widenIndicesU8(src, count, dst.data());
+                        return;
+                    case cgltf_component_type_r_16u:
+                        widenIndicesU16(reinterpret_cast<const uint16_t *>(src), count, dst.data());
+                        return;
+                    case cgltf_component_type_r_32u:
+                        copyIndicesU32(reinterpret_cast<const uint32_t *>(src), count, dst.data());
+                        return;
+                    default:
+                        break;
+                    }
+                }
+            }
+
+            for (cgltf_size i = 0; i < accessor->count; ++i)
             {
-                // fallback if degenerate — pick any axis not collinear with N
-                glm::vec3 ref = (std::abs(n.z) < 0.999f) ? glm::vec3(0, 0, 1) : glm::vec3(0, 1, 0);
-                t = glm::normalize(glm::cross(ref, n));
+                const cgltf_size idx = cgltf_accessor_read_index(accessor, i);
+                dst[static_cast<size_t>(i)] = static_cast<uint32_t>(idx);
             }
-            t = glm::normalize(t - n * glm::dot(n, t));
-            glm::vec3 b = glm::cross(n, t);
-            float w = (glm::dot(b, B[i]) < 0.0f) ? -1.0f : 1.0f;
-
-            md.tangents[4 * i + 0] = t.x;
-            md.tangents[4 * i + 1] = t.y;
-            md.tangents[4 * i + 2] = t.z;
-            md.tangents[4 * i + 3] = w;
         }
-    }
 
-} // namespace
+        /// World transforms for all nodes in one top-down pass (parents before children).
+        std::vector<glm::mat4> computeWorldTransforms(const cgltf_data &data)
+        {
+            std::vector<glm::mat4> world(data.nodes_count, glm::mat4(1.0f));
+
+            std::vector<const cgltf_node *> stack;
+            for (cgltf_size ni = 0; ni < data.nodes_count; ++ni)
+            {
+                if (!data.nodes[ni].parent)
+                    stack.push_back(&data.nodes[ni]);
+            }
 
-namespace Asset
-{
+            while (!stack.empty())
+            {
+                const cgltf_node *node = stack.back();
+                stack.pop_back();
 
-    // --- internal helpers (do not leak to header) ---
-    namespace
-    {
+                cgltf_float m[16];
+                cgltf_node_transform_local(node, m);
 
-        struct CgltfDeleter
+                const size_t idx = static_cast<size_t>(node - data.nodes);
+                const glm::mat4 parentXf = node->parent ? world[static_cast<size_t>(node->parent - data.nodes)]
+                                                        : glm::mat4(1.0f);
+                // glTF is column-major; glm::make_mat4 expects column-major.
+                world[idx] = parentXf * glm::make_mat4(m);
+
+                for (cgltf_size ci = 0; ci < node->children_count; ++ci)
+                    stack.push_back(node->children[ci]);
+            }
+
+            return world;
+        }
+
+        /// Expand EXT_mesh_gpu_instancing attributes into per-instance local matrices.
+        std::vector<glm::mat4> gpuInstanceTransforms(const cgltf_node &node)
         {
-            void operator()(cgltf_data *d) const noexcept
+            const cgltf_accessor *translation = nullptr;
+            const cgltf_accessor *rotation = nullptr;
+            const cgltf_accessor *scale = nullptr;
+
+            const cgltf_mesh_gpu_instancing &inst = node.mesh_gpu_instancing;
+            for (cgltf_size ai = 0; ai < inst.attributes_count; ++ai)
             {
-                if (d)
-                    cgltf_free(d);
+                const cgltf_attribute &attr = inst.attributes[ai];
+                if (!attr.name || !attr.data)
+                    continue;
+
+                const std::string_view name(attr.name);
+                if (name == "TRANSLATION" && attr.data->type == cgltf_type_vec3)
+                    translation = attr.data;
+                else if (name == "ROTATION" && attr.data->type == cgltf_type_vec4)
+                    rotation = attr.data;
+                else if (name == "SCALE" && attr.data->type == cgltf_type_vec3)
+                    scale = attr.data;
             }
-        };
-        using CgltfPtr = std::unique_ptr<cgltf_data, CgltfDeleter>;
 
-        inline bool isVecN(const cgltf_accessor *acc, cgltf_type type, int comps)
-        {
-            return acc && acc->type == type && cgltf_num_components(acc->type) == comps;
+            cgltf_size count = 0;
+            for (const cgltf_accessor *acc : {translation, rotation, scale})
+            {
+                if (acc)
+                    count = count ? std::min(count, acc->count) : acc->count;
+            }
+
+            std::vector<glm::mat4> out;
+            out.reserve(static_cast<size_t>(count));
+            for (cgltf_size i = 0; i < count; ++i)
+            {
+                glm::vec3 t(0.0f), s(1.0f);
+                glm::vec4 r(0.0f, 0.0f, 0.0f, 1.0f); // glTF quaternion: x, y, z, w
+                if (translation)
+                    cgltf_accessor_read_float(translation, i, &t.x, 3);
+                if (rotation)
+                    cgltf_accessor_read_float(rotation, i, &r.x, 4);
+                if (scale)
+                    cgltf_accessor_read_float(scale, i, &s.x, 3);
+
+                const glm::quat q(r.w, r.x, r.y, r.z);
+                out.push_back(glm::translate(glm::mat4(1.0f), t) * glm::mat4_cast(q) * glm::scale(glm::mat4(1.0f), s));
+            }
+            return out;
         }
 
-        void copyAttributeFloats(const cgltf_accessor *accessor, std::vector<float> &dst)
+        /// Quantized (KHR_mesh_quantization) unit vectors aren't unit length after dequantization.
+        void renormalize(std::vector<float> &v, size_t stride)
         {
-            const cgltf_size count = accessor->count * cgltf_num_components(accessor->type);
-            dst.resize(static_cast<size_t>(count));
-            cgltf_accessor_unpack_floats(accessor, dst.data(), count);
+            for (size_t i = 0; i + 2 < v.size(); i += stride)
+            {
+                const float len2 = v[i] * v[i] + v[i + 1] * v[i + 1] + v[i + 2] * v[i + 2];
+                if (len2 > 0.0f)
+                {
+                    const float inv = 1.0f / std::sqrt(len2);
+                    v[i] *= inv;
+                    v[i + 1] *= inv;
+                    v[i + 2] *= inv;
+                }
+            }
         }
 
-        void copyIndices(const cgltf_accessor *accessor, std::vector<uint32_t> &dst)
+        /// Warn about required extensions we don't implement (geometry may come out wrong).
+        void checkRequiredExtensions(const cgltf_data &data, const std::string &path)
         {
-            dst.resize(static_cast<size_t>(accessor->count));
-            for (cgltf_size i = 0; i < accessor->count; ++i)
+            static constexpr std::string_view kSupported[] = {
+                "KHR_mesh_quantization",
+                "EXT_meshopt_compression",
+                "EXT_mesh_gpu_instancing",
+            };
+
+            for (cgltf_size i = 0; i < data.extensions_required_count; ++i)
             {
-                const cgltf_size idx = cgltf_accessor_read_index(accessor, i);
-                dst[static_cast<size_t>(i)] = static_cast<uint32_t>(idx);
+                const std::string_view ext(data.extensions_required[i]);
+                if (std::find(std::begin(kSupported), std::end(kSupported), ext) == std::end(kSupported))
+                    Logger::log(LogLevel::WARNING, "glTF '" + path + "' requires unsupported extension " + std::string(ext));
             }
         }
 
-        glm::mat4 nodeWorldTransform(const cgltf_node *node)
+        struct PrimitiveJob
         {
-            if (!node)
-                return glm::mat4(1.0f);
-
-            // Prefer cgltf_node_transform_world (handles hierarchy)
-            cgltf_float m[16];
-            cgltf_node_transform_world(node, m);
-            // glTF is column-major; glm::make_mat4 expects column-major.
-            return glm::make_mat4(m);
+            const cgltf_primitive *prim = nullptr;
+            cgltf_size meshIndex = 0;
+        };
+
+        /// Decode one triangle primitive into MeshData (independent of every other primitive).
+        std::optional<MeshData> decodePrimitive(const PrimitiveJob &job)
+        {
+            const cgltf_primitive &prim = *job.prim;
+
+            MeshData md{};
+
+            // Attributes
+            for (cgltf_size ai = 0; ai < prim.attributes_count; ++ai)
+            {
+                const cgltf_attribute &attr = prim.attributes[ai];
+                const cgltf_accessor *acc = attr.data;
+                if (!acc)
+                    continue;
+
+                switch (attr.type)
+                {
+                case cgltf_attribute_type_position:
+                    if (isVecN(acc, cgltf_type_vec3, 3))
+                    {
+                        copyAttributeFloats(acc, md.positions);
+                    }
+                    else
+                    {
+                        Logger::log(LogLevel::WARNING, "POSITION accessor is not vec3; skipping.");
+                    }
+                    break;
+
+                case cgltf_attribute_type_normal:
+                    if (isVecN(acc, cgltf_type_vec3, 3))
+                    {
+                        copyAttributeFloats(acc, md.normals);
+                        if (acc->component_type != cgltf_component_type_r_32f)
+                            renormalize(md.normals, 3);
+                    }
+                    else
+                    {
+                        // Not critical — many assets omit normals or use different layout
+                        Logger::log(LogLevel::WARNING, "NORMAL accessor is not vec3; skipping.");
+                    }
+                    break;
+
+                case cgltf_attribute_type_texcoord:
+                    if (attr.index == 0)
+                    {
+                        if (isVecN(acc, cgltf_type_vec2, 2))
+                        {
+                            copyAttributeFloats(acc, md.texcoords);
+                        }
+                        else
+                        {
+                            Logger::log(LogLevel::WARNING, "TEXCOORD_0 accessor is not vec2; skipping.");
+                        }
+                    }
+                    break;
+
+                case cgltf_attribute_type_tangent:
+                    if (isVecN(acc, cgltf_type_vec4, 4))
+                    {
+                        copyAttributeFloats(acc, md.tangents); // 4 * V (x,y,z,w)
+                        if (acc->component_type != cgltf_component_type_r_32f)
+                            renormalize(md.tangents, 4);
+                    }
+                    else
+                    {
+                        Logger::log(LogLevel::WARNING, "TANGENT accessor is not vec4; skipping.");
+                    }
+                    break;
+
+                default:
+                    break;
+                }
+            }
+
+            // Indices (or generate a trivial 0..N-1)
+            if (prim.indices)
+            {
+                copyIndices(prim.indices, md.indices);
+            }
+            else
+            {
+                const size_t vcount = md.positions.size() / 3;
+                md.indices.resize(vcount);
+                for (size_t i = 0; i < vcount; ++i)
+                    md.indices[i] = static_cast<uint32_t>(i);
+            }
+
+            // Minimal sanity: ensure positions exist and index count % 3 == 0 for triangles
+            if (md.positions.empty())
+            {
+                Logger::log(LogLevel::WARNING, "Primitive of mesh #" + std::to_string(job.meshIndex) +
+                                                   " has no POSITION; skipping.");
+                return std::nullopt;
+            }
+            if (md.indices.size() % 3 != 0)
+            {
+                Logger::log(LogLevel::WARNING, "Index count is not a multiple of 3; primitive may be invalid.");
+            }
+
+            return md;
         }
 
     } // namespace
 
     // --- public API ---
-    std::vector<MeshData> GltfLoader::loadMeshes(const std::string &path)
+    ModelData GltfLoader::loadModel(const std::string &path, const GltfLoadOptions &opts)
     {
+        Core::Stopwatch timer;
+
+        // Declared before the cgltf_data so mappings outlive every pointer into them
+        MappedFileStore mappedFiles;
+
         cgltf_options options{};
+        if (opts.memoryMap)
+        {
+            options.file.read = &MappedFileStore::read;
+            options.file.release = &MappedFileStore::release;
+            options.file.user_data = &mappedFiles;
+        }
+
         cgltf_data *raw = nullptr;
 
         const cgltf_result parsed = cgltf_parse_file(&options, path.c_str(), &raw);
@@ -172,129 +418,132 @@ namespace Asset
             throw std::runtime_error("Failed to load glTF buffers: " + path);
         }
 
-        std::vector<MeshData> meshes;
-        meshes.reserve(data->meshes_count > 0 ? static_cast<size_t>(data->meshes_count) : 1u);
+        checkRequiredExtensions(*data, path);
+        const unsigned threads = Core::resolveThreadCount(opts.threadCount);
+
+        // 1) EXT_meshopt_compression: decode compressed views up front (parallel across views)
+        const MeshoptDecodeStats meshopt = decodeMeshoptBufferViews(*data, threads);
+        if (meshopt.bufferViews > 0)
+        {
+            CORE_LOG_INFO("GltfLoader: meshopt decoded " + std::to_string(meshopt.bufferViews) + " buffer views, " +
+                          std::to_string(meshopt.compressedBytes) + " -> " + std::to_string(meshopt.decodedBytes) +
+                          " bytes in " + std::to_string(meshopt.milliseconds) + " ms (" +
+                          std::to_string(meshopt.megabytesPerSecond()) + " MB/s)");
+        }
 
-        // Iterate nodes → mesh primitives
+        // 2) Which meshes are actually placed by a node (unreferenced meshes aren't decoded)
+        std::vector<bool> meshUsed(data->meshes_count, false);
         for (cgltf_size ni = 0; ni < data->nodes_count; ++ni)
         {
-            const cgltf_node *node = &data->nodes[ni];
-            if (!node || !node->mesh)
-                continue;
+            if (const cgltf_mesh *mesh = data->nodes[ni].mesh)
+                meshUsed[static_cast<size_t>(mesh - data->meshes)] = true;
+        }
 
-            const glm::mat4 nodeXf = nodeWorldTransform(node);
-            const cgltf_mesh &mesh = *node->mesh;
+        // 3) One job per unique triangle primitive, in mesh/primitive order
+        std::vector<PrimitiveJob> jobs;
+        for (cgltf_size mi = 0; mi < data->meshes_count; ++mi)
+        {
+            if (!meshUsed[mi])
+                continue;
 
+            const cgltf_mesh &mesh = data->meshes[mi];
             for (cgltf_size pi = 0; pi < mesh.primitives_count; ++pi)
             {
                 const cgltf_primitive &prim = mesh.primitives[pi];
 
                 if (prim.type != cgltf_primitive_type_triangles)
                 {
-                    Logger::log(LogLevel::WARNING, "Skipping non-triangle primitive at node #" + std::to_string(ni));
+                    Logger::log(LogLevel::WARNING, "Skipping non-triangle primitive in mesh #" + std::to_string(mi));
                     continue;
                 }
 
-                MeshData md{};
-                md.localTransform = nodeXf;
+                jobs.push_back(PrimitiveJob{&prim, mi});
+            }
+        }
 
-                // Attributes
-                for (cgltf_size ai = 0; ai < prim.attributes_count; ++ai)
-                {
-                    const cgltf_attribute &attr = prim.attributes[ai];
-                    const cgltf_accessor *acc = attr.data;
-                    if (!acc)
-                        continue;
+        // 4) Decode primitives in parallel; each job writes only its own slot
+        std::vector<std::optional<MeshData>> decoded(jobs.size());
 
-                    switch (attr.type)
-                    {
-                    case cgltf_attribute_type_position:
-                        if (isVecN(acc, cgltf_type_vec3, 3))
-                        {
-                            copyAttributeFloats(acc, md.positions);
-                        }
-                        else
-                        {
-                            Logger::log(LogLevel::WARNING, "POSITION accessor is not vec3; skipping.");
-                        }
-                        break;
+        Core::parallelFor(jobs.size(), threads, [&](size_t i)
+                          { decoded[i] = decodePrimitive(jobs[i]); });
 
-                    case cgltf_attribute_type_normal:
-                        if (isVecN(acc, cgltf_type_vec3, 3))
-                        {
-                            copyAttributeFloats(acc, md.normals);
-                        }
-                        else
-                        {
-                            // Not critical — many assets omit normals or use different layout
-                            Logger::log(LogLevel::WARNING, "NORMAL accessor is not vec3; skipping.");
-                        }
-                        break;
-
-                    case cgltf_attribute_type_texcoord:
-                        if (attr.index == 0)
-                        {
-                            if (isVecN(acc, cgltf_type_vec2, 2))
-                            {
-                                copyAttributeFloats(acc, md.texcoords);
-                            }
-                            else
-                            {
-                                Logger::log(LogLevel::WARNING, "TEXCOORD_0 accessor is not vec2; skipping.");
-                            }
-                        }
-                        break;
+        // 5) Compact (skipped primitives drop out, order is preserved) and map mesh -> geometry ids
+        ModelData model;
+        model.meshes.reserve(jobs.size());
 
-                    case cgltf_attribute_type_tangent:
-                        if (isVecN(acc, cgltf_type_vec4, 4))
-                        {
-                            copyAttributeFloats(acc, md.tangents); // 4 * V (x,y,z,w)
-                        }
-                        else
-                        {
-                            Logger::log(LogLevel::WARNING, "TANGENT accessor is not vec4; skipping.");
-                        }
-                        break;
+        std::vector<std::vector<uint32_t>> meshGeometry(data->meshes_count);
+        for (size_t i = 0; i < decoded.size(); ++i)
+        {
+            if (!decoded[i])
+                continue;
+            meshGeometry[static_cast<size_t>(jobs[i].meshIndex)].push_back(static_cast<uint32_t>(model.meshes.size()));
+            model.meshes.push_back(std::move(*decoded[i]));
+        }
 
-                    default:
-                        break;
-                    }
-                }
+        // 6) Missing normals/tangents. Small meshes run in parallel across meshes;
+        //    big ones one at a time, each using all workers internally.
+        {
+            constexpr size_t kLargeMeshIndices = 3u * 256u * 1024u;
 
-                // Indices (or generate a trivial 0..N-1)
-                if (prim.indices)
-                {
-                    copyIndices(prim.indices, md.indices);
-                }
+            auto generate = [](MeshData &md, unsigned attrThreads)
+            {
+                Processing::AttributeSettings as{};
+                as.threadCount = attrThreads;
+                if (!md.hasNormals())
+                    Processing::ComputeNormals(md, as);
+                if (md.tangents.empty() && md.hasTexcoord0())
+                    Processing::ComputeTangents(md, as);
+            };
+
+            std::vector<MeshData *> small;
+            for (auto &md : model.meshes)
+            {
+                if (md.indices.size() >= kLargeMeshIndices)
+                    generate(md, threads);
                 else
-                {
-                    const size_t vcount = md.positions.size() / 3;
-                    md.indices.resize(vcount);
-                    for (size_t i = 0; i < vcount; ++i)
-                        md.indices[i] = static_cast<uint32_t>(i);
-                }
+                    small.push_back(&md);
+            }
+            Core::parallelFor(small.size(), threads, [&](size_t i)
+                              { generate(*small[i], 1); });
+        }
 
-                // Minimal sanity: ensure positions exist and index count % 3 == 0 for triangles
-                if (md.positions.empty())
-                {
-                    Logger::log(LogLevel::WARNING, "Mesh primitive has no POSITION; skipping.");
-                    continue;
-                }
-                if (md.indices.size() % 3 != 0)
-                {
-                    Logger::log(LogLevel::WARNING, "Index count is not a multiple of 3; primitive may be invalid.");
-                }
+        // 7) Instances: node order, world transforms from a single hierarchy pass
+        const std::vector<glm::mat4> world = computeWorldTransforms(*data);
+        for (cgltf_size ni = 0; ni < data->nodes_count; ++ni)
+        {
+            const cgltf_node &node = data->nodes[ni];
+            if (!node.mesh)
+                continue;
 
-                if (md.tangents.empty() && !md.normals.empty() && !md.texcoords.empty())
-                {
-                    GenerateTangents(md);
-                }
+            const auto &geometry = meshGeometry[static_cast<size_t>(node.mesh - data->meshes)];
+            if (geometry.empty())
+                continue;
 
-                meshes.push_back(std::move(md));
+            auto emit = [&](const glm::mat4 &xf)
+            {
+                for (uint32_t g : geometry)
+                    model.instances.push_back(MeshInstance{g, xf});
+            };
+
+            if (node.has_mesh_gpu_instancing)
+            {
+                for (const glm::mat4 &local : gpuInstanceTransforms(node))
+                    emit(world[ni] * local);
+            }
+            else
+            {
+                emit(world[ni]);
             }
         }
 
-        return meshes;
+        CORE_LOG_DEBUG("GltfLoader: " + std::to_string(model.meshes.size()) + " unique primitives, " +
+                       std::to_string(model.instances.size()) + " instances from '" + path + "' on " +
+                       std::to_string(std::min<size_t>(threads, std::max<size_t>(jobs.size(), 1))) +
+                       " thread(s) in " + std::to_string(timer.elapsedMs()) + " ms (" +
+                       (opts.memoryMap ? "mapped" : "heap") + " buffers, peak RSS " +
+                       std::to_string(Core::peakResidentSetBytes() / (1024 * 1024)) + " MB)");
+
+        return model;
     }
 
 } // namespace Asset
@@ -0,0 +1,102 @@
+#include "asset/io/GltfMeshopt.h"
+
+#include "core/ParallelFor.h"
+#include "core/Stopwatch.h"
+
+#include <meshoptimizer.h>
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Asset
+{
+
+    MeshoptDecodeStats decodeMeshoptBufferViews(cgltf_data &data, unsigned threadCount)
+    {
+        MeshoptDecodeStats stats{};
+
+        // 1) Collect compressed views that still need decoding
+        std::vector<cgltf_buffer_view *> views;
+        for (cgltf_size i = 0; i < data.buffer_views_count; ++i)
+        {
+            cgltf_buffer_view &view = data.buffer_views[i];
+            if (view.has_meshopt_compression && !view.data)
+                views.push_back(&view);
+        }
+        if (views.empty())
+            return stats;
+
+        Core::Stopwatch timer;
+
+        // 2) Decode in parallel; every view owns its output allocation
+        Core::parallelFor(views.size(), threadCount, [&](size_t i)
+                          {
+            cgltf_buffer_view &view = *views[i];
+            const cgltf_meshopt_compression &mc = view.meshopt_compression;
+
+            if (!mc.buffer || !mc.buffer->data || mc.offset + mc.size > mc.buffer->size)
+                throw std::runtime_error("EXT_meshopt_compression: source buffer missing for view '" +
+                                         std::string(view.name ? view.name : "") + "'");
+
+            const auto *src = static_cast<const unsigned char *>(mc.buffer->data) + mc.offset;
+            const size_t bytes = mc.count * mc.stride;
+
+            // cgltf_free releases view.data with its default free_func (free)
+            void *dst = std::malloc(bytes ? bytes : 1);
+            if (!dst)
+                throw std::runtime_error("EXT_meshopt_compression: out of memory");
+
+            int rc = -1;
+            switch (mc.mode)
+            {
+            case cgltf_meshopt_compression_mode_attributes:
+                rc = meshopt_decodeVertexBuffer(dst, mc.count, mc.stride, src, mc.size);
+                break;
+            case cgltf_meshopt_compression_mode_triangles:
+                rc = meshopt_decodeIndexBuffer(dst, mc.count, mc.stride, src, mc.size);
+                break;
+            case cgltf_meshopt_compression_mode_indices:
+                rc = meshopt_decodeIndexSequence(dst, mc.count, mc.stride, src, mc.size);
+                break;
+            default:
+                break;
+            }
+
+            if (rc != 0)
+            {
+                std::free(dst);
+                throw std::runtime_error("EXT_meshopt_compression: failed to decode buffer view (mode " +
+                                         std::to_string(int(mc.mode)) + ")");
+            }
+
+            switch (mc.filter)
+            {
+            case cgltf_meshopt_compression_filter_octahedral:
+                meshopt_decodeFilterOct(dst, mc.count, mc.stride);
+                break;
+            case cgltf_meshopt_compression_filter_quaternion:
+                meshopt_decodeFilterQuat(dst, mc.count, mc.stride);
+                break;
+            case cgltf_meshopt_compression_filter_exponential:
+                meshopt_decodeFilterExp(dst, mc.count, mc.stride);
+                break;
+            default:
+                break;
+            }
+
+            view.data = dst; });
+
+        // 3) Totals
+        for (const cgltf_buffer_view *view : views)
+        {
+            stats.compressedBytes += view->meshopt_compression.size;
+            stats.decodedBytes += view->meshopt_compression.count * view->meshopt_compression.stride;
+        }
+        stats.bufferViews = views.size();
+        stats.milliseconds = timer.elapsedMs();
+        return stats;
+    }
+
+} // namespace Asset
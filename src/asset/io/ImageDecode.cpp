@@ -0,0 +1,117 @@
+#include "asset/io/ImageDecode.h"
+
+#include "core/Logger.h"
+#include "core/ParallelFor.h"
+#include "core/Stopwatch.h"
+#include "core/StringUtils.h" // Core::Str::assetNameFromPath
+
+#include <stb_image.h>
+
+#include <algorithm>
+
+namespace Asset
+{
+
+    void DecodedPixelsDeleter::operator()(unsigned char *pixels) const noexcept
+    {
+        stbi_image_free(pixels);
+    }
+
+    void ImageDecodeBatch::request(const std::string &path, int channels)
+    {
+        if (path.empty())
+            return;
+
+        const auto key = std::make_pair(path, channels);
+        if (index_.count(key))
+            return;
+
+        DecodedImage img;
+        img.path = path;
+        img.channels = channels;
+        index_.emplace(key, images_.size());
+        images_.push_back(std::move(img));
+    }
+
+    ImageDecodeStats ImageDecodeBatch::decodeAll(unsigned threadCount)
+    {
+        ImageDecodeStats stats{};
+        Core::Stopwatch wall;
+
+        // 1) Collect the images still to decode
+        std::vector<std::size_t> pending;
+        pending.reserve(images_.size());
+        for (std::size_t i = 0; i < images_.size(); ++i)
+            if (!images_[i].ok() && images_[i].error.empty())
+                pending.push_back(i);
+
+        auto decode = [&](std::size_t n)
+        {
+            DecodedImage &img = images_[pending[n]];
+            Core::Stopwatch sw;
+
+            int w = 0, h = 0, comp = 0;
+            img.pixels.reset(stbi_load(img.path.c_str(), &w, &h, &comp, img.channels));
+            if (img.pixels)
+            {
+                img.width = uint32_t(w);
+                img.height = uint32_t(h);
+                img.components = img.channels != 0 ? img.channels : comp;
+            }
+            else
+            {
+                const char *reason = stbi_failure_reason();
+                img.error = reason ? reason : "unknown error";
+            }
+            img.decodeMs = sw.elapsedMs();
+        };
+
+        // 2) Decode; a single image or a single worker gains nothing from the pool, so stay on this thread.
+        //    Otherwise fan out: stb keeps its failure reason thread-local, so stbi_load is safe to run concurrently
+        stats.threads = unsigned(std::min<std::size_t>(Core::resolveThreadCount(threadCount), pending.size()));
+        if (stats.threads <= 1)
+        {
+            for (std::size_t n = 0; n < pending.size(); ++n)
+                decode(n);
+        }
+        else
+        {
+            Core::parallelFor(pending.size(), stats.threads, decode);
+        }
+        stats.wallMs = wall.elapsedMs();
+
+        // 3) Per-image timings + totals (logged on the calling thread, in request order)
+        for (std::size_t i : pending)
+        {
+            const DecodedImage &img = images_[i];
+            ++stats.images;
+            stats.decodeMsTotal += img.decodeMs;
+            if (!img.ok())
+            {
+                ++stats.failed;
+                CORE_LOG_WARN("ImageDecode: failed '" + img.path + "': " + img.error);
+                continue;
+            }
+            stats.decodedBytes += img.bytes();
+            CORE_LOG_DEBUG("ImageDecode: " + Core::Str::assetNameFromPath(img.path) + " " +
+                           std::to_string(img.width) + "x" + std::to_string(img.height) + "x" +
+                           std::to_string(img.components) + " in " + std::to_string(img.decodeMs) + " ms");
+        }
+
+        if (stats.images > 0)
+        {
+            CORE_LOG_INFO("ImageDecode: " + std::to_string(stats.images) + " images (" +
+                          std::to_string(stats.decodedBytes >> 20) + " MiB) on " + std::to_string(stats.threads) +
+                          " threads in " + std::to_string(stats.wallMs) + " ms" +
+                          (stats.failed ? ", " + std::to_string(stats.failed) + " failed" : std::string()));
+        }
+        return stats;
+    }
+
+    const DecodedImage *ImageDecodeBatch::find(const std::string &path, int channels) const
+    {
+        const auto it = index_.find(std::make_pair(path, channels));
+        return it != index_.end() ? &images_[it->second] : nullptr;
+    }
+
+} // namespace Asset
@@ -0,0 +1,90 @@
+#include "asset/io/IndexWidening.h"
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define OME3D_WIDEN_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OME3D_WIDEN_SSE2 1
+#endif
+
+namespace Asset
+{
+
+    void widenIndicesU8(const std::uint8_t *src, std::size_t count, std::uint32_t *dst) noexcept
+    {
+        std::size_t i = 0;
+
+#if defined(OME3D_WIDEN_AVX2)
+        // 16 indices per iteration: two 8-byte loads -> two 8x u32 stores
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i lo = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i));
+            const __m128i hi = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i + 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_cvtepu8_epi32(lo));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 8), _mm256_cvtepu8_epi32(hi));
+        }
+#elif defined(OME3D_WIDEN_SSE2)
+        // 16 indices per iteration: u8 -> u16 -> u32 by interleaving with zero
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            const __m128i w0 = _mm_unpacklo_epi8(v, zero);
+            const __m128i w1 = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 0), _mm_unpacklo_epi16(w0, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), _mm_unpackhi_epi16(w0, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 8), _mm_unpacklo_epi16(w1, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 12), _mm_unpackhi_epi16(w1, zero));
+        }
+#endif
+
+        for (; i < count; ++i)
+            dst[i] = src[i];
+    }
+
+    void widenIndicesU16(const std::uint16_t *src, std::size_t count, std::uint32_t *dst) noexcept
+    {
+        std::size_t i = 0;
+
+#if defined(OME3D_WIDEN_AVX2)
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_cvtepu16_epi32(lo));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 8), _mm256_cvtepu16_epi32(hi));
+        }
+#elif defined(OME3D_WIDEN_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 0), _mm_unpacklo_epi16(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), _mm_unpackhi_epi16(v, zero));
+        }
+#endif
+
+        for (; i < count; ++i)
+            dst[i] = src[i];
+    }
+
+    void copyIndicesU32(const std::uint32_t *src, std::size_t count, std::uint32_t *dst) noexcept
+    {
+        std::memcpy(dst, src, count * sizeof(std::uint32_t));
+    }
+
+    const char *indexWideningPath() noexcept
+    {
+#if defined(OME3D_WIDEN_AVX2)
+        return "AVX2";
+#elif defined(OME3D_WIDEN_SSE2)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+} // namespace Asset
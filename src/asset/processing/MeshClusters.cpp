@@ -0,0 +1,62 @@
+#include "asset/processing/MeshClusters.h"
+
+#include <meshoptimizer.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Asset::Processing
+{
+
+    void BuildMeshlets(MeshData &md, const MeshletSettings &s)
+    {
+        md.meshlets.clear();
+
+        const size_t vertexCount = md.vertexCount();
+        const size_t baseCount = md.baseIndexCount();
+        if (vertexCount == 0 || baseCount < 3 || baseCount % 3 != 0)
+            return;
+
+        const size_t maxVertices = std::clamp<size_t>(s.maxVertices, 3, 256);
+        const size_t maxTriangles = std::clamp<size_t>(s.maxTriangles & ~3u, 4, 512);
+
+        // 1) Partition LOD 0 (meshlet-local vertex lists + byte triangles)
+        std::vector<meshopt_Meshlet> clusters(meshopt_buildMeshletsBound(baseCount, maxVertices, maxTriangles));
+        std::vector<unsigned int> clusterVertices(baseCount);
+        std::vector<unsigned char> clusterTriangles(baseCount);
+
+        const size_t clusterCount = meshopt_buildMeshlets(clusters.data(), clusterVertices.data(), clusterTriangles.data(),
+                                                          md.indices.data(), baseCount,
+                                                          md.positions.data(), vertexCount, 3 * sizeof(float),
+                                                          maxVertices, maxTriangles, s.coneWeight);
+        clusters.resize(clusterCount);
+
+        // 2) Per cluster: local triangle order, bounds, then back to global indices in place.
+        //    Meshlets cover every LOD 0 triangle exactly once, so the range is simply rewritten.
+        md.meshlets.reserve(clusterCount);
+        std::uint32_t cursor = 0;
+        for (const meshopt_Meshlet &c : clusters)
+        {
+            unsigned int *verts = clusterVertices.data() + c.vertex_offset;
+            unsigned char *tris = clusterTriangles.data() + c.triangle_offset;
+
+            meshopt_optimizeMeshlet(verts, tris, c.triangle_count, c.vertex_count);
+
+            const meshopt_Bounds b = meshopt_computeMeshletBounds(verts, tris, c.triangle_count,
+                                                                  md.positions.data(), vertexCount, 3 * sizeof(float));
+
+            Meshlet m{};
+            m.firstIndex = cursor;
+            m.indexCount = c.triangle_count * 3;
+            std::copy(b.center, b.center + 3, m.center);
+            m.radius = b.radius;
+            std::copy(b.cone_axis, b.cone_axis + 3, m.coneAxis);
+            m.coneCutoff = b.cone_cutoff;
+            md.meshlets.push_back(m);
+
+            for (size_t i = 0; i < size_t(c.triangle_count) * 3; ++i)
+                md.indices[cursor++] = verts[tris[i]];
+        }
+    }
+
+} // namespace Asset::Processing
@@ -0,0 +1,70 @@
+#include "asset/processing/MeshLodChain.h"
+
+#include <meshoptimizer.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Asset::Processing
+{
+
+    void GenerateLodChain(MeshData &md, const LodSettings &s)
+    {
+        // 1) Drop a previous chain; LOD 0 is whatever the full-detail range is
+        md.indices.resize(md.baseIndexCount());
+        md.lods.clear();
+
+        const size_t vertexCount = md.vertexCount();
+        const size_t baseCount = md.indices.size();
+        if (vertexCount == 0 || baseCount < 3 || baseCount % 3 != 0)
+            return;
+
+        md.lods.push_back(MeshLod{0u, static_cast<std::uint32_t>(baseCount), 0.0f});
+
+        // 2) Absolute error budget (coarse levels only reference a subset of vertices,
+        //    so use Sparse mode and keep errors in mesh units rather than subset-relative)
+        const float scale = meshopt_simplifyScale(md.positions.data(), vertexCount, 3 * sizeof(float));
+        const float stepError = s.maxStepError * scale;
+        const unsigned options = meshopt_SimplifySparse | meshopt_SimplifyErrorAbsolute;
+
+        std::vector<unsigned int> prev(md.indices.begin(), md.indices.end());
+        std::vector<unsigned int> lod;
+        float accumulatedError = 0.0f;
+
+        // 3) Each level simplifies the previous one
+        for (std::uint32_t level = 1; level < s.maxLevels; ++level)
+        {
+            size_t target = static_cast<size_t>(double(prev.size()) * s.reductionRatio);
+            target -= target % 3;
+            if (target / 3 < s.minTriangles)
+                break;
+
+            lod.resize(prev.size());
+            float stepResult = 0.0f;
+            size_t written = meshopt_simplify(lod.data(), prev.data(), prev.size(),
+                                              md.positions.data(), vertexCount, 3 * sizeof(float),
+                                              target, stepError, options, &stepResult);
+            written -= written % 3;
+
+            // Not enough progress within the error budget: coarser levels would only repeat this one
+            if (written < 3 || double(written) > double(prev.size()) * (1.0 - s.minReduction))
+                break;
+
+            lod.resize(written);
+            meshopt_optimizeVertexCache(lod.data(), lod.data(), lod.size(), vertexCount);
+
+            accumulatedError += stepResult;
+            md.lods.push_back(MeshLod{static_cast<std::uint32_t>(md.indices.size()),
+                                      static_cast<std::uint32_t>(lod.size()),
+                                      accumulatedError});
+            md.indices.insert(md.indices.end(), lod.begin(), lod.end());
+
+            prev.swap(lod);
+        }
+
+        // A single level is the same as no chain
+        if (md.lods.size() == 1)
+            md.lods.clear();
+    }
+
+} // namespace Asset::Processing
@@ -1,4 +1,5 @@
 #include "asset/processing/MeshOptimize.h"
+#include "core/Stopwatch.h"
 #include <meshoptimizer.h>
 #include <cstddef>
 #include <algorithm>
@@ -6,112 +7,142 @@
 namespace Asset::Processing
 {
 
-    void OptimizeMeshInPlace(MeshData &md, const OptimizeSettings &s)
+    namespace
     {
-        const size_t vertexCount = md.positions.size() / 3;
-        const size_t indexCount = md.indices.size();
-        if (vertexCount == 0 || indexCount == 0)
-            return;
-
-        // 1) Build a temporary interleaved vertex buffer (pos+normal+uv) so all passes
-        //    (remap/overdraw/fetch) operate coherently on the same stream.
-        struct Vtx
-        {
-            float px, py, pz;
-            float nx, ny, nz;
-            float u, v;
-        };
-
-        std::vector<Vtx> verts(vertexCount);
-        const bool hasNormals = md.normals.size() == md.positions.size();
-        const bool hasTexcoords = (md.texcoords.size() / 2) == vertexCount;
-
-        for (size_t i = 0; i < vertexCount; ++i)
+        /// Tracks transient allocations so the optimizer can report its high-water mark.
+        struct ScratchMeter
         {
-            verts[i].px = md.positions[i * 3 + 0];
-            verts[i].py = md.positions[i * 3 + 1];
-            verts[i].pz = md.positions[i * 3 + 2];
+            std::size_t current = 0;
+            std::size_t peak = 0;
 
-            if (hasNormals)
-            {
-                verts[i].nx = md.normals[i * 3 + 0];
-                verts[i].ny = md.normals[i * 3 + 1];
-                verts[i].nz = md.normals[i * 3 + 2];
-            }
-            else
+            void add(std::size_t bytes)
             {
-                // Fallback if source mesh has no normals.
-                verts[i].nx = 0.f;
-                verts[i].ny = 1.f;
-                verts[i].nz = 0.f;
+                current += bytes;
+                peak = std::max(peak, current);
             }
+            void release(std::size_t bytes) { current -= bytes; }
+        };
 
-            if (hasTexcoords)
-            {
-                verts[i].u = md.texcoords[i * 2 + 0];
-                verts[i].v = md.texcoords[i * 2 + 1];
-            }
-            else
+        /// Apply an old->new vertex remap to every present stream, one temporary at a time.
+        /// Entries equal to ~0u (unreferenced vertices) are dropped by meshopt.
+        void remapVertexStreams(MeshData &md, const std::vector<unsigned int> &remap,
+                                size_t oldVertexCount, size_t newVertexCount, ScratchMeter &scratch)
+        {
+            md.forEachVertexStream([&](std::vector<float> &stream, size_t components)
+                                   {
+                const size_t bytes = newVertexCount * components * sizeof(float);
+                scratch.add(bytes);
+                {
+                    std::vector<float> out(newVertexCount * components);
+                    meshopt_remapVertexBuffer(out.data(), stream.data(), oldVertexCount,
+                                              components * sizeof(float), remap.data());
+                    stream.swap(out);
+                } // old stream freed here
+                scratch.release(bytes); });
+        }
+
+        /// Reorder vertices for fetch locality and compact away unreferenced ones.
+        void optimizeFetch(MeshData &md, ScratchMeter &scratch)
+        {
+            const size_t vertexCount = md.vertexCount();
+            const size_t remapBytes = vertexCount * sizeof(unsigned int);
+            scratch.add(remapBytes);
             {
-                verts[i].u = 0.f;
-                verts[i].v = 0.f;
+                std::vector<unsigned int> remap(vertexCount);
+                const size_t used = meshopt_optimizeVertexFetchRemap(remap.data(), md.indices.data(),
+                                                                     md.indices.size(), vertexCount);
+                meshopt_remapIndexBuffer(md.indices.data(), md.indices.data(), md.indices.size(), remap.data());
+                remapVertexStreams(md, remap, vertexCount, used, scratch);
             }
+            scratch.release(remapBytes);
         }
 
-        // 2) Generate a vertex remap (removes duplicate vertices and compacts the vertex buffer).
-        std::vector<unsigned int> remap(indexCount);
-        const size_t newVertexCount = meshopt_generateVertexRemap(
-            remap.data(),
-            md.indices.data(), indexCount,
-            verts.data(), vertexCount, sizeof(Vtx));
+    } // namespace
 
-        // Apply remap to index and vertex buffers.
-        std::vector<unsigned int> newIndices(indexCount);
-        meshopt_remapIndexBuffer(newIndices.data(), md.indices.data(), indexCount, remap.data());
+    void OptimizeMeshInPlace(MeshData &md, const OptimizeSettings &s, OptimizeStats *stats)
+    {
+        // Coarser LODs and meshlets would reference the old order; they are rebuilt at the end.
+        md.indices.resize(md.baseIndexCount());
+        md.lods.clear();
+        md.meshlets.clear();
 
-        std::vector<Vtx> newVerts(newVertexCount);
-        meshopt_remapVertexBuffer(newVerts.data(), verts.data(), vertexCount, sizeof(Vtx), remap.data());
+        const size_t vertexCount = md.vertexCount();
+        const size_t indexCount = md.indices.size();
+        if (vertexCount == 0 || indexCount == 0)
+            return;
+
+        OptimizeStats local{};
+        ScratchMeter scratch;
+        Core::Stopwatch sw;
+
+        // 1) Optional streams that don't match the vertex count can't be remapped consistently
+        if (!md.hasNormals())
+            md.normals.clear();
+        if (!md.hasTexcoord0())
+            md.texcoords.clear();
+        if (!md.hasTangents())
+            md.tangents.clear();
+
+        // 2) Deduplicate vertices over all present streams (no interleaved copy) and compact them.
+        {
+            meshopt_Stream streams[16];
+            size_t streamCount = 0;
+            md.forEachVertexStream([&](std::vector<float> &stream, size_t components)
+                                   { streams[streamCount++] = {stream.data(), components * sizeof(float), components * sizeof(float)}; });
+
+            const size_t remapBytes = vertexCount * sizeof(unsigned int);
+            scratch.add(remapBytes);
+            {
+                std::vector<unsigned int> remap(vertexCount);
+                const size_t uniqueCount = meshopt_generateVertexRemapMulti(
+                    remap.data(), md.indices.data(), indexCount, vertexCount, streams, streamCount);
 
-        verts.swap(newVerts);
-        md.indices.assign(newIndices.begin(), newIndices.end());
+                meshopt_remapIndexBuffer(md.indices.data(), md.indices.data(), indexCount, remap.data());
+                remapVertexStreams(md, remap, vertexCount, uniqueCount, scratch);
+            }
+            scratch.release(remapBytes);
+        }
+        local.remapMs = sw.elapsedMs();
 
         // 3) Pre-transform vertex cache optimization (triangle order).
         if (s.optimizeCache)
         {
+            sw.reset();
             meshopt_optimizeVertexCache(md.indices.data(),
                                         md.indices.data(),
                                         md.indices.size(),
-                                        verts.size());
+                                        md.vertexCount());
+            local.cacheMs = sw.elapsedMs();
         }
 
         // 4) Overdraw optimization (uses position stream).
         if (s.optimizeOverdraw)
         {
+            sw.reset();
             meshopt_optimizeOverdraw(md.indices.data(),
                                      md.indices.data(),
                                      md.indices.size(),
-                                     &verts[0].px, // pointer to first float3 position
-                                     verts.size(),
-                                     sizeof(Vtx),
+                                     md.positions.data(),
+                                     md.vertexCount(),
+                                     3 * sizeof(float),
                                      s.overdrawThreshold);
+            local.overdrawMs = sw.elapsedMs();
         }
 
-        // 5) Post-transform vertex fetch optimization (reorders vertices to memory-friendly order).
+        // 5) Post-transform vertex fetch optimization (reorders every stream by first use).
         if (s.optimizeFetch)
         {
-            meshopt_optimizeVertexFetch(verts.data(),
-                                        md.indices.data(),
-                                        md.indices.size(),
-                                        verts.data(),
-                                        verts.size(),
-                                        sizeof(Vtx));
+            sw.reset();
+            optimizeFetch(md, scratch);
+            local.fetchMs = sw.elapsedMs();
         }
 
         // 6) Optional triangle count reduction (LOD).
         if (s.simplify)
         {
+            sw.reset();
             const size_t curIndexCount = md.indices.size();
-            const size_t vertexCountNow = verts.size();
+            const size_t vertexCountNow = md.vertexCount();
 
             // sanity: need triangles and vertices
             if (curIndexCount >= 3 && (curIndexCount % 3) == 0 && vertexCountNow > 0)
@@ -127,14 +158,17 @@ namespace Asset::Processing
                     target = (curIndexCount >= 6) ? (curIndexCount - 3) : 3;
                 }
 
+                const size_t lodBytes = curIndexCount * sizeof(MeshData::Index);
+                scratch.add(lodBytes);
+
                 std::vector<unsigned int> lod(curIndexCount);
 
                 size_t written = meshopt_simplify(
                     lod.data(),
                     md.indices.data(), curIndexCount,
-                    &verts[0].px,
+                    md.positions.data(),
                     vertexCountNow,
-                    sizeof(Vtx),
+                    3 * sizeof(float),
                     target,
                     s.simplifyError);
 
@@ -144,9 +178,9 @@ namespace Asset::Processing
                     written = meshopt_simplifySloppy(
                         lod.data(),
                         md.indices.data(), curIndexCount,
-                        &verts[0].px,
+                        md.positions.data(),
                         vertexCountNow,
-                        sizeof(Vtx),
+                        3 * sizeof(float),
                         target,
                         err);
                 }
@@ -160,39 +194,41 @@ namespace Asset::Processing
                 {
                     lod.resize(written);
                     md.indices.swap(lod);
+                    lod = {};
 
                     meshopt_optimizeVertexCache(
                         md.indices.data(), md.indices.data(),
                         md.indices.size(), vertexCountNow);
 
-                    meshopt_optimizeVertexFetch(
-                        verts.data(),
-                        md.indices.data(), md.indices.size(),
-                        verts.data(), vertexCountNow, sizeof(Vtx));
+                    // Also drops the vertices the simplifier no longer references
+                    optimizeFetch(md, scratch);
                 }
                 // else: keep original indices
+
+                scratch.release(lodBytes);
             }
+            local.simplifyMs = sw.elapsedMs();
         }
 
-        // 7) De-interleave back into MeshData (SoA layout).
-        const size_t vCount = verts.size();
-        md.positions.resize(vCount * 3);
-        md.normals.resize(vCount * 3);
-        md.texcoords.resize(vCount * 2);
-
-        for (size_t i = 0; i < vCount; ++i)
+        // 7) Meshlets: regroups the LOD 0 triangles into clusters (vertex order is unaffected).
+        if (s.buildMeshlets)
         {
-            md.positions[i * 3 + 0] = verts[i].px;
-            md.positions[i * 3 + 1] = verts[i].py;
-            md.positions[i * 3 + 2] = verts[i].pz;
-
-            md.normals[i * 3 + 0] = verts[i].nx;
-            md.normals[i * 3 + 1] = verts[i].ny;
-            md.normals[i * 3 + 2] = verts[i].nz;
+            sw.reset();
+            BuildMeshlets(md, s.meshlet);
+            local.meshletMs = sw.elapsedMs();
+        }
 
-            md.texcoords[i * 2 + 0] = verts[i].u;
-            md.texcoords[i * 2 + 1] = verts[i].v;
+        // 8) LOD chain over the final vertex order.
+        if (s.generateLods)
+        {
+            sw.reset();
+            GenerateLodChain(md, s.lod);
+            local.lodMs = sw.elapsedMs();
         }
+
+        local.peakScratchBytes = scratch.peak;
+        if (stats)
+            *stats = local;
     }
 
 } // namespace Asset::Processing
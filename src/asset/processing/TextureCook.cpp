@@ -0,0 +1,576 @@
+#include "asset/processing/TextureCook.h"
+#include "core/ParallelFor.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace Asset::Processing
+{
+
+    namespace
+    {
+        // ------------------------------------------------------------------------
+        // Mip chain (float RGBA, linear space for sRGB sources)
+        // ------------------------------------------------------------------------
+        struct FloatImage
+        {
+            std::uint32_t width = 0;
+            std::uint32_t height = 0;
+            std::vector<float> texels; // RGBA, 0..255
+        };
+
+        float srgbToLinear(float c) noexcept
+        {
+            c /= 255.0f;
+            const float l = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+            return l * 255.0f;
+        }
+
+        float linearToSrgb(float l) noexcept
+        {
+            l = std::clamp(l / 255.0f, 0.0f, 1.0f);
+            const float c = (l <= 0.0031308f) ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+            return c * 255.0f;
+        }
+
+        FloatImage toFloat(const std::uint8_t *rgba, std::uint32_t w, std::uint32_t h, bool srgb)
+        {
+            std::array<float, 256> lut{};
+            for (int i = 0; i < 256; ++i)
+                lut[i] = srgb ? srgbToLinear(float(i)) : float(i);
+
+            FloatImage img{w, h, std::vector<float>(std::size_t(w) * h * 4)};
+            for (std::size_t i = 0; i < std::size_t(w) * h; ++i)
+            {
+                for (int c = 0; c < 3; ++c)
+                    img.texels[4 * i + c] = lut[rgba[4 * i + c]];
+                img.texels[4 * i + 3] = float(rgba[4 * i + 3]); // alpha is always linear
+            }
+            return img;
+        }
+
+        /// 2x2 box filter; the last row/column of odd sizes is clamped like the blit chain.
+        FloatImage downsample(const FloatImage &src)
+        {
+            FloatImage dst{std::max(1u, src.width / 2), std::max(1u, src.height / 2), {}};
+            dst.texels.resize(std::size_t(dst.width) * dst.height * 4);
+
+            for (std::uint32_t y = 0; y < dst.height; ++y)
+            {
+                const std::uint32_t y0 = std::min(2 * y, src.height - 1);
+                const std::uint32_t y1 = std::min(2 * y + 1, src.height - 1);
+                for (std::uint32_t x = 0; x < dst.width; ++x)
+                {
+                    const std::uint32_t x0 = std::min(2 * x, src.width - 1);
+                    const std::uint32_t x1 = std::min(2 * x + 1, src.width - 1);
+                    const float *a = &src.texels[(std::size_t(y0) * src.width + x0) * 4];
+                    const float *b = &src.texels[(std::size_t(y0) * src.width + x1) * 4];
+                    const float *c = &src.texels[(std::size_t(y1) * src.width + x0) * 4];
+                    const float *d = &src.texels[(std::size_t(y1) * src.width + x1) * 4];
+                    float *out = &dst.texels[(std::size_t(y) * dst.width + x) * 4];
+                    for (int k = 0; k < 4; ++k)
+                        out[k] = 0.25f * (a[k] + b[k] + c[k] + d[k]);
+                }
+            }
+            return dst;
+        }
+
+        std::vector<std::uint8_t> toBytes(const FloatImage &img, bool srgb)
+        {
+            std::vector<std::uint8_t> out(img.texels.size());
+            for (std::size_t i = 0; i < img.texels.size(); ++i)
+            {
+                const bool color = (i % 4) != 3;
+                const float v = (srgb && color) ? linearToSrgb(img.texels[i]) : img.texels[i];
+                out[i] = std::uint8_t(std::clamp(std::lround(v), 0l, 255l));
+            }
+            return out;
+        }
+
+        /// Unit tangent-space normals (XYZ in -1..1) of a normal map's R, G bytes; Z is rebuilt like frag.glsl does.
+        FloatImage toNormals(const std::uint8_t *rgba, std::uint32_t w, std::uint32_t h)
+        {
+            FloatImage img{w, h, std::vector<float>(std::size_t(w) * h * 4)};
+            for (std::size_t i = 0; i < std::size_t(w) * h; ++i)
+            {
+                float x = float(rgba[4 * i + 0]) / 127.5f - 1.0f;
+                float y = float(rgba[4 * i + 1]) / 127.5f - 1.0f;
+                const float xy = x * x + y * y;
+                if (xy > 1.0f)
+                {
+                    const float s = 1.0f / std::sqrt(xy);
+                    x *= s;
+                    y *= s;
+                }
+                img.texels[4 * i + 0] = x;
+                img.texels[4 * i + 1] = y;
+                img.texels[4 * i + 2] = std::sqrt(std::max(0.0f, 1.0f - x * x - y * y));
+                img.texels[4 * i + 3] = 1.0f;
+            }
+            return img;
+        }
+
+        /// Averaged normals -> R, G = direction X, Y; B = Toksvig variance (1 - |n|) / |n| in 0..1; A = 255.
+        std::vector<std::uint8_t> normalBytes(const FloatImage &img)
+        {
+            auto unorm = [](float v)
+            { return std::uint8_t(std::clamp(std::lround(v * 255.0f), 0l, 255l)); };
+
+            std::vector<std::uint8_t> out(img.texels.size());
+            for (std::size_t i = 0; i < img.texels.size(); i += 4)
+            {
+                const float *n = &img.texels[i];
+                const float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                const float inv = len > 1e-4f ? 1.0f / len : 0.0f; // fully cancelled: flat, maximal variance
+                out[i + 0] = unorm(n[0] * inv * 0.5f + 0.5f);
+                out[i + 1] = unorm(n[1] * inv * 0.5f + 0.5f);
+                out[i + 2] = unorm(len > 1e-4f ? std::min(1.0f, (1.0f - len) * inv) : 1.0f);
+                out[i + 3] = 255;
+            }
+            return out;
+        }
+
+        /// Gather a 4x4 block at block (bx, by), replicating edge texels past the border.
+        void fetchBlock(const std::uint8_t *rgba, std::uint32_t w, std::uint32_t h,
+                        std::uint32_t bx, std::uint32_t by, std::uint8_t out[16][4])
+        {
+            for (std::uint32_t j = 0; j < 4; ++j)
+            {
+                const std::uint32_t y = std::min(by * 4 + j, h - 1);
+                for (std::uint32_t i = 0; i < 4; ++i)
+                {
+                    const std::uint32_t x = std::min(bx * 4 + i, w - 1);
+                    std::memcpy(out[j * 4 + i], rgba + (std::size_t(y) * w + x) * 4, 4);
+                }
+            }
+        }
+
+        // ------------------------------------------------------------------------
+        // BC4 / BC5
+        // ------------------------------------------------------------------------
+
+        /// One BC4 block (8 bytes) from 16 values, 8-value mode with min/max endpoints.
+        void encodeBC4(const std::uint8_t values[16], std::uint8_t out[8])
+        {
+            std::uint8_t lo = 255, hi = 0;
+            for (int i = 0; i < 16; ++i)
+            {
+                lo = std::min(lo, values[i]);
+                hi = std::max(hi, values[i]);
+            }
+
+            out[0] = hi; // red_0 > red_1 selects the 8-value palette
+            out[1] = lo;
+            std::uint64_t bits = 0;
+            if (hi != lo)
+            {
+                int palette[8];
+                palette[0] = hi;
+                palette[1] = lo;
+                for (int k = 2; k < 8; ++k)
+                    palette[k] = ((8 - k) * hi + (k - 1) * lo + 3) / 7;
+
+                for (int i = 0; i < 16; ++i)
+                {
+                    int best = 0, bestErr = 256;
+                    for (int k = 0; k < 8; ++k)
+                    {
+                        const int err = std::abs(palette[k] - int(values[i]));
+                        if (err < bestErr)
+                        {
+                            bestErr = err;
+                            best = k;
+                        }
+                    }
+                    bits |= std::uint64_t(best) << (3 * i);
+                }
+            }
+            // else: hi == lo -> every index 0 (red_0)
+
+            for (int b = 0; b < 6; ++b)
+                out[2 + b] = std::uint8_t(bits >> (8 * b));
+        }
+
+        void encodeBC4Block(const std::uint8_t texels[16][4], std::uint8_t *out)
+        {
+            std::uint8_t r[16];
+            for (int i = 0; i < 16; ++i)
+                r[i] = texels[i][0];
+            encodeBC4(r, out);
+        }
+
+        void encodeBC5Block(const std::uint8_t texels[16][4], std::uint8_t *out)
+        {
+            std::uint8_t r[16], g[16];
+            for (int i = 0; i < 16; ++i)
+            {
+                r[i] = texels[i][0];
+                g[i] = texels[i][1];
+            }
+            encodeBC4(r, out);
+            encodeBC4(g, out + 8);
+        }
+
+        // ------------------------------------------------------------------------
+        // BC7 mode 6
+        // ------------------------------------------------------------------------
+        constexpr int kWeights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        struct Mode6Endpoints
+        {
+            int q[2][4]; // 7-bit per channel
+            int p[2];    // p-bits
+        };
+
+        /// Closest 7-bit + shared p-bit representation of one float endpoint.
+        void quantizeEndpoint(const float e[4], int q[4], int &p)
+        {
+            float bestErr = 1e30f;
+            for (int pb = 0; pb < 2; ++pb)
+            {
+                int cand[4];
+                float err = 0.0f;
+                for (int c = 0; c < 4; ++c)
+                {
+                    cand[c] = std::clamp(int(std::lround((e[c] - float(pb)) * 0.5f)), 0, 127);
+                    const float d = float((cand[c] << 1) | pb) - e[c];
+                    err += d * d;
+                }
+                if (err < bestErr)
+                {
+                    bestErr = err;
+                    p = pb;
+                    std::copy(cand, cand + 4, q);
+                }
+            }
+        }
+
+        /// Pick the best weight per texel; returns the total squared error.
+        int assignIndices(const Mode6Endpoints &ep, const std::uint8_t texels[16][4], int indices[16])
+        {
+            int palette[16][4];
+            for (int c = 0; c < 4; ++c)
+            {
+                const int e0 = (ep.q[0][c] << 1) | ep.p[0];
+                const int e1 = (ep.q[1][c] << 1) | ep.p[1];
+                for (int k = 0; k < 16; ++k)
+                    palette[k][c] = ((64 - kWeights4[k]) * e0 + kWeights4[k] * e1 + 32) >> 6;
+            }
+
+            int total = 0;
+            for (int i = 0; i < 16; ++i)
+            {
+                int best = 0, bestErr = 1 << 30;
+                for (int k = 0; k < 16; ++k)
+                {
+                    int err = 0;
+                    for (int c = 0; c < 4; ++c)
+                    {
+                        const int d = palette[k][c] - int(texels[i][c]);
+                        err += d * d;
+                    }
+                    if (err < bestErr)
+                    {
+                        bestErr = err;
+                        best = k;
+                    }
+                }
+                indices[i] = best;
+                total += bestErr;
+            }
+            return total;
+        }
+
+        /// Least-squares endpoints for fixed weights (2x2 normal equations shared by all channels).
+        bool refineEndpoints(const std::uint8_t texels[16][4], const int indices[16], float e0[4], float e1[4])
+        {
+            float aa = 0, ab = 0, bb = 0;
+            float ax[4] = {}, bx[4] = {};
+            for (int i = 0; i < 16; ++i)
+            {
+                const float w = float(kWeights4[indices[i]]) / 64.0f;
+                const float a = 1.0f - w;
+                aa += a * a;
+                ab += a * w;
+                bb += w * w;
+                for (int c = 0; c < 4; ++c)
+                {
+                    ax[c] += a * float(texels[i][c]);
+                    bx[c] += w * float(texels[i][c]);
+                }
+            }
+            const float det = aa * bb - ab * ab;
+            if (std::fabs(det) < 1e-6f)
+                return false;
+
+            for (int c = 0; c < 4; ++c)
+            {
+                e0[c] = std::clamp((ax[c] * bb - bx[c] * ab) / det, 0.0f, 255.0f);
+                e1[c] = std::clamp((bx[c] * aa - ax[c] * ab) / det, 0.0f, 255.0f);
+            }
+            return true;
+        }
+
+        void encodeBC7Block(const std::uint8_t texels[16][4], std::uint8_t *out)
+        {
+            // 1) Principal axis of the block colors (power iteration on the covariance)
+            float mean[4] = {};
+            for (int i = 0; i < 16; ++i)
+                for (int c = 0; c < 4; ++c)
+                    mean[c] += float(texels[i][c]) / 16.0f;
+
+            float cov[4][4] = {};
+            for (int i = 0; i < 16; ++i)
+            {
+                float d[4];
+                for (int c = 0; c < 4; ++c)
+                    d[c] = float(texels[i][c]) - mean[c];
+                for (int r = 0; r < 4; ++r)
+                    for (int c = 0; c < 4; ++c)
+                        cov[r][c] += d[r] * d[c];
+            }
+
+            float axis[4] = {1.0f, 1.0f, 1.0f, 0.25f};
+            for (int it = 0; it < 8; ++it)
+            {
+                float next[4] = {};
+                for (int r = 0; r < 4; ++r)
+                    for (int c = 0; c < 4; ++c)
+                        next[r] += cov[r][c] * axis[c];
+                const float len = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2] + next[3] * next[3]);
+                if (len < 1e-6f)
+                    break; // flat block: any axis works
+                for (int c = 0; c < 4; ++c)
+                    axis[c] = next[c] / len;
+            }
+
+            // 2) Endpoints = extreme projections onto the axis
+            float tMin = 1e30f, tMax = -1e30f;
+            for (int i = 0; i < 16; ++i)
+            {
+                float t = 0.0f;
+                for (int c = 0; c < 4; ++c)
+                    t += (float(texels[i][c]) - mean[c]) * axis[c];
+                tMin = std::min(tMin, t);
+                tMax = std::max(tMax, t);
+            }
+            float e0[4], e1[4];
+            for (int c = 0; c < 4; ++c)
+            {
+                e0[c] = std::clamp(mean[c] + tMin * axis[c], 0.0f, 255.0f);
+                e1[c] = std::clamp(mean[c] + tMax * axis[c], 0.0f, 255.0f);
+            }
+
+            // 3) Quantize + index, then one least-squares pass (kept only if it helps)
+            Mode6Endpoints best{};
+            quantizeEndpoint(e0, best.q[0], best.p[0]);
+            quantizeEndpoint(e1, best.q[1], best.p[1]);
+            int indices[16];
+            int bestErr = assignIndices(best, texels, indices);
+
+            if (bestErr > 0 && refineEndpoints(texels, indices, e0, e1))
+            {
+                Mode6Endpoints refined{};
+                quantizeEndpoint(e0, refined.q[0], refined.p[0]);
+                quantizeEndpoint(e1, refined.q[1], refined.p[1]);
+                int refinedIdx[16];
+                const int err = assignIndices(refined, texels, refinedIdx);
+                if (err < bestErr)
+                {
+                    best = refined;
+                    bestErr = err;
+                    std::copy(refinedIdx, refinedIdx + 16, indices);
+                }
+            }
+
+            // 4) Anchor texel 0 must have its index MSB clear: swap endpoints if needed
+            if (indices[0] >= 8)
+            {
+                std::swap(best.q[0], best.q[1]);
+                std::swap(best.p[0], best.p[1]);
+                for (int &idx : indices)
+                    idx = 15 - idx;
+            }
+
+            // 5) Pack 128 bits LSB-first: mode(7) | R0 R1 G0 G1 B0 B1 A0 A1 (7 each) | P0 P1 | indices (3 + 15*4)
+            std::uint64_t words[2] = {0, 0};
+            int pos = 0;
+            auto put = [&](std::uint64_t value, int bits)
+            {
+                for (int b = 0; b < bits; ++b, ++pos)
+                    words[pos >> 6] |= ((value >> b) & 1ull) << (pos & 63);
+            };
+
+            put(1ull << 6, 7); // mode 6
+            for (int c = 0; c < 4; ++c)
+            {
+                put(std::uint64_t(best.q[0][c]), 7);
+                put(std::uint64_t(best.q[1][c]), 7);
+            }
+            put(std::uint64_t(best.p[0]), 1);
+            put(std::uint64_t(best.p[1]), 1);
+            put(std::uint64_t(indices[0]), 3);
+            for (int i = 1; i < 16; ++i)
+                put(std::uint64_t(indices[i]), 4);
+
+            std::memcpy(out, words, 16);
+        }
+
+        /// Encode one level into @p out (sized for its block grid).
+        void encodeLevel(const std::vector<std::uint8_t> &rgba, std::uint32_t w, std::uint32_t h,
+                         TextureCodec codec, std::uint8_t *out, unsigned threadCount)
+        {
+            if (CodecBlockDim(codec) == 1)
+            {
+                // Uncompressed: keep the first N channels of every texel
+                const std::uint32_t channels = CodecBlockBytes(codec);
+                if (channels == 4)
+                {
+                    std::memcpy(out, rgba.data(), rgba.size());
+                    return;
+                }
+                for (std::size_t i = 0; i < std::size_t(w) * h; ++i)
+                    for (std::uint32_t c = 0; c < channels; ++c)
+                        out[i * channels + c] = rgba[i * 4 + c];
+                return;
+            }
+
+            const std::uint32_t blocksX = (w + 3) / 4;
+            const std::uint32_t blocksY = (h + 3) / 4;
+            const std::uint32_t blockBytes = CodecBlockBytes(codec);
+
+            // Rows of blocks are independent; small levels stay on one thread
+            const unsigned threads = (std::size_t(blocksX) * blocksY >= 256) ? threadCount : 1u;
+            Core::parallelFor(blocksY, threads, [&](std::size_t by)
+                              {
+                std::uint8_t texels[16][4];
+                for (std::uint32_t bx = 0; bx < blocksX; ++bx)
+                {
+                    fetchBlock(rgba.data(), w, h, bx, std::uint32_t(by), texels);
+                    std::uint8_t *dst = out + (by * blocksX + bx) * blockBytes;
+                    switch (codec)
+                    {
+                    case TextureCodec::BC7:
+                        encodeBC7Block(texels, dst);
+                        break;
+                    case TextureCodec::BC5:
+                        encodeBC5Block(texels, dst);
+                        break;
+                    case TextureCodec::BC4:
+                        encodeBC4Block(texels, dst);
+                        break;
+                    default:
+                        break;
+                    }
+                } });
+        }
+
+        /// Fill @p tex.levels / size @p tex.data for the full chain of tex.width x tex.height; returns the level count.
+        /// Sizes are block-aligned, so every offset is a multiple of the block size.
+        std::uint32_t layoutLevels(CookedTexture &tex)
+        {
+            const std::uint32_t levelCount = 1u + std::uint32_t(std::floor(std::log2(std::max(tex.width, tex.height))));
+            const std::uint32_t dim = CodecBlockDim(tex.codec);
+
+            std::uint64_t cursor = 0;
+            std::uint32_t w = tex.width, h = tex.height;
+            for (std::uint32_t i = 0; i < levelCount; ++i)
+            {
+                const std::uint64_t blocks = std::uint64_t((w + dim - 1) / dim) * ((h + dim - 1) / dim);
+                tex.levels.push_back({cursor, blocks * CodecBlockBytes(tex.codec), w, h});
+                cursor += tex.levels.back().bytes;
+                w = std::max(1u, w / 2);
+                h = std::max(1u, h / 2);
+            }
+            tex.data.resize(cursor);
+            return levelCount;
+        }
+
+    } // namespace
+
+    std::uint32_t CodecBlockBytes(TextureCodec codec) noexcept
+    {
+        switch (codec)
+        {
+        case TextureCodec::BC7:
+        case TextureCodec::BC5:
+            return 16;
+        case TextureCodec::BC4:
+            return 8;
+        case TextureCodec::RG8:
+            return 2;
+        case TextureCodec::R8:
+            return 1;
+        default:
+            return 4;
+        }
+    }
+
+    std::uint32_t CodecBlockDim(TextureCodec codec) noexcept
+    {
+        switch (codec)
+        {
+        case TextureCodec::BC7:
+        case TextureCodec::BC5:
+        case TextureCodec::BC4:
+            return 4;
+        default:
+            return 1;
+        }
+    }
+
+    CookedTexture CookTexture(const std::uint8_t *rgba, std::uint32_t width, std::uint32_t height,
+                              TextureCodec codec, bool srgb, unsigned threadCount)
+    {
+        CookedTexture out{};
+        out.codec = codec;
+        out.srgb = srgb;
+        out.width = width;
+        out.height = height;
+        if (!rgba || width == 0 || height == 0)
+            return out;
+
+        // 1) Level table
+        const std::uint32_t levelCount = layoutLevels(out);
+
+        // 2) Filter in float (linear for sRGB), re-quantize per level and encode
+        FloatImage level = toFloat(rgba, width, height, srgb);
+        for (std::uint32_t i = 0; i < levelCount; ++i)
+        {
+            if (i > 0)
+                level = downsample(level);
+            const std::vector<std::uint8_t> bytes =
+                (i == 0) ? std::vector<std::uint8_t>(rgba, rgba + std::size_t(width) * height * 4) : toBytes(level, srgb);
+            encodeLevel(bytes, level.width, level.height, codec, out.data.data() + out.levels[i].offset, threadCount);
+        }
+        return out;
+    }
+
+    CookedTexture CookNormalMap(const std::uint8_t *rgba, std::uint32_t width, std::uint32_t height,
+                                TextureCodec codec, unsigned threadCount)
+    {
+        CookedTexture out{};
+        out.codec = codec;
+        out.width = width;
+        out.height = height;
+        if (!rgba || width == 0 || height == 0)
+            return out;
+
+        // 1) Level table
+        const std::uint32_t levelCount = layoutLevels(out);
+
+        // 2) Box-filter unit vectors: the averages shorten where the normals diverge, which is the variance
+        FloatImage level = toNormals(rgba, width, height);
+        for (std::uint32_t i = 0; i < levelCount; ++i)
+        {
+            if (i > 0)
+                level = downsample(level);
+            encodeLevel(normalBytes(level), level.width, level.height, codec, out.data.data() + out.levels[i].offset,
+                        threadCount);
+        }
+        return out;
+    }
+
+} // namespace Asset::Processing
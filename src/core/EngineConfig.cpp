@@ -0,0 +1,111 @@
+#include "core/EngineConfig.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <limits>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace Core
+{
+    namespace
+    {
+        std::string_view trim(std::string_view s)
+        {
+            const auto first = s.find_first_not_of(" \t\r");
+            if (first == std::string_view::npos)
+                return {};
+            const auto last = s.find_last_not_of(" \t\r");
+            return s.substr(first, last - first + 1);
+        }
+
+        bool parseU32(std::string_view s, std::uint32_t &out)
+        {
+            std::uint32_t v = 0;
+            const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), v);
+            if (ec != std::errc{} || ptr != s.data() + s.size())
+                return false;
+            out = v;
+            return true;
+        }
+    } // namespace
+
+    EngineConfig EngineConfig::load(const std::filesystem::path &path)
+    {
+        EngineConfig cfg{};
+
+        std::ifstream in(path);
+        if (!in)
+            return cfg;
+
+        std::string line;
+        int lineNo = 0;
+        while (std::getline(in, line))
+        {
+            ++lineNo;
+
+            // 1) Strip comments / blank lines
+            std::string_view text(line);
+            if (const auto hash = text.find('#'); hash != std::string_view::npos)
+                text = text.substr(0, hash);
+            text = trim(text);
+            if (text.empty())
+                continue;
+
+            // 2) Split "key = value"
+            const auto eq = text.find('=');
+            const std::string where = path.string() + ":" + std::to_string(lineNo);
+            if (eq == std::string_view::npos)
+            {
+                CORE_LOG_WARN("EngineConfig: " + where + ": expected 'key = value'");
+                continue;
+            }
+            const std::string_view key = trim(text.substr(0, eq));
+            const std::string_view value = trim(text.substr(eq + 1));
+
+            // 3) Known keys: sizes must be positive, counts may be 0 (off), switches are 0 / 1
+            constexpr std::uint32_t kAny = std::numeric_limits<std::uint32_t>::max();
+            const struct
+            {
+                std::string_view name;
+                std::uint32_t *dst;
+                std::uint32_t min;
+                std::uint32_t max;
+            } keys[] = {
+                {"stagingRingMiB", &cfg.stagingRingMiB, 1, kAny},
+                {"geometryVertexPageMiB", &cfg.geometryVertexPageMiB, 1, kAny},
+                {"geometryIndexPageMiB", &cfg.geometryIndexPageMiB, 1, kAny},
+                {"stressSceneObjects", &cfg.stressSceneObjects, 0, kAny},
+                {"gpuDriven", &cfg.gpuDriven, 0, 1},
+                {"smokeFrames", &cfg.smokeFrames, 0, kAny},
+                {"uploadBenchMiB", &cfg.uploadBenchMiB, 0, kAny},
+            };
+
+            const auto known = std::find_if(std::begin(keys), std::end(keys),
+                                            [&](const auto &k)
+                                            { return k.name == key; });
+            if (known == std::end(keys))
+            {
+                CORE_LOG_WARN("EngineConfig: " + where + ": unknown key '" + std::string(key) + "'");
+                continue;
+            }
+
+            std::uint32_t v = 0;
+            if (parseU32(value, v) && v >= known->min && v <= known->max)
+                *known->dst = v;
+            else if (known->max == 1)
+                CORE_LOG_WARN("EngineConfig: " + where + ": " + std::string(key) + " must be 0 or 1");
+            else if (known->min == 0)
+                CORE_LOG_WARN("EngineConfig: " + where + ": " + std::string(key) + " must be a non-negative integer");
+            else
+                CORE_LOG_WARN("EngineConfig: " + where + ": " + std::string(key) + " must be a positive integer");
+        }
+
+        CORE_LOG_INFO("EngineConfig: loaded " + path.string());
+        return cfg;
+    }
+
+} // namespace Core
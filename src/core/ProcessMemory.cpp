@@ -0,0 +1,36 @@
+#include "core/ProcessMemory.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#undef ERROR
+#else
+#include <sys/resource.h>
+#endif
+
+namespace Core
+{
+
+    std::size_t peakResidentSetBytes() noexcept
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS pmc{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+            return static_cast<std::size_t>(pmc.PeakWorkingSetSize);
+        return 0;
+#else
+        struct rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+#if defined(__APPLE__)
+        return static_cast<std::size_t>(usage.ru_maxrss); // bytes
+#else
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024u; // kilobytes
+#endif
+#endif
+    }
+
+} // namespace Core
@@ -0,0 +1,49 @@
+#include "core/RadixSort.h"
+
+#include <array>
+
+namespace Core
+{
+    void radixSort(std::vector<SortEntry> &entries, std::vector<SortEntry> &scratch)
+    {
+        const std::size_t n = entries.size();
+        if (n < 2)
+            return;
+        scratch.resize(n);
+
+        // 1) All eight histograms in one read of the keys
+        std::array<std::array<std::uint32_t, 256>, 8> counts{};
+        for (const SortEntry &e : entries)
+        {
+            for (int d = 0; d < 8; ++d)
+                ++counts[d][(e.key >> (d * 8)) & 0xFF];
+        }
+
+        // 2) Scatter digit by digit, least significant first
+        SortEntry *src = entries.data();
+        SortEntry *dst = scratch.data();
+        for (int d = 0; d < 8; ++d)
+        {
+            std::array<std::uint32_t, 256> &count = counts[d];
+            if (count[(src[0].key >> (d * 8)) & 0xFF] == n)
+                continue; // every key has the same digit: order unchanged
+
+            std::uint32_t offset = 0;
+            for (std::uint32_t &c : count)
+            {
+                const std::uint32_t bucket = c;
+                c = offset;
+                offset += bucket;
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+                dst[count[(src[i].key >> (d * 8)) & 0xFF]++] = src[i];
+            std::swap(src, dst);
+        }
+
+        // 3) Result must end up in entries
+        if (src != entries.data())
+            entries.swap(scratch);
+    }
+
+} // namespace Core
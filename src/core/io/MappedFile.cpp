@@ -0,0 +1,128 @@
+#include "core/io/MappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#undef ERROR
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Core::IO
+{
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+            fileHandle_ = std::exchange(other.fileHandle_, nullptr);
+            mappingHandle_ = std::exchange(other.mappingHandle_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    bool MappedFile::open(const std::string &path) noexcept
+    {
+        close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        fileHandle_ = file;
+        mappingHandle_ = mapping;
+        data_ = static_cast<const std::uint8_t *>(view);
+        size_ = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        void *view = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file; the descriptor is no longer needed.
+        ::close(fd);
+        if (view == MAP_FAILED)
+            return false;
+
+        data_ = static_cast<const std::uint8_t *>(view);
+        size_ = static_cast<std::size_t>(st.st_size);
+#endif
+        return true;
+    }
+
+    void MappedFile::adviseSequential() const noexcept
+    {
+#ifndef _WIN32
+        if (data_)
+            ::madvise(const_cast<std::uint8_t *>(data_), size_, MADV_SEQUENTIAL);
+#endif
+    }
+
+    void MappedFile::close() noexcept
+    {
+#ifdef _WIN32
+        if (data_)
+            UnmapViewOfFile(data_);
+        if (mappingHandle_)
+            CloseHandle(static_cast<HANDLE>(mappingHandle_));
+        if (fileHandle_)
+            CloseHandle(static_cast<HANDLE>(fileHandle_));
+        mappingHandle_ = nullptr;
+        fileHandle_ = nullptr;
+#else
+        if (data_)
+            ::munmap(const_cast<std::uint8_t *>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+} // namespace Core::IO
@@ -0,0 +1,140 @@
+#include "core/math/MathUtils.h"
+
+#include <glm/glm.hpp>
+
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define OME3D_CULL_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OME3D_CULL_SSE2 1
+#endif
+
+namespace Core::MathUtils
+{
+    Frustum extractFrustum(const glm::mat4 &m) noexcept
+    {
+        const glm::vec4 r0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const glm::vec4 r1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const glm::vec4 r2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        const glm::vec4 r3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        Frustum f;
+        f.planes[0] = r3 + r0; // left
+        f.planes[1] = r3 - r0; // right
+        f.planes[2] = r3 + r1; // bottom / top (Y is flipped in the projection; both are kept)
+        f.planes[3] = r3 - r1;
+        f.planes[4] = r2;      // near
+        f.planes[5] = r3 - r2; // far
+
+        for (glm::vec4 &p : f.planes)
+            p /= glm::length(glm::vec3(p));
+        return f;
+    }
+
+    std::size_t cullAABBs(const Frustum &frustum, const AABBSoA &boxes, uint32_t *outIndices) noexcept
+    {
+        // A box is outside a plane when even its farthest corner along the normal is behind it:
+        // dot(n, c) + w + dot(|n|, e) < 0
+        const std::size_t n = boxes.size();
+        const float *cx = boxes.cx.data(), *cy = boxes.cy.data(), *cz = boxes.cz.data();
+        const float *ex = boxes.ex.data(), *ey = boxes.ey.data(), *ez = boxes.ez.data();
+
+        std::size_t count = 0;
+        std::size_t i = 0;
+
+#if defined(OME3D_CULL_AVX2)
+        // 1) Eight boxes per iteration
+        __m256 pn[6][3], pa[6][3], pw[6];
+        for (int p = 0; p < 6; ++p)
+        {
+            const glm::vec4 &pl = frustum.planes[p];
+            for (int k = 0; k < 3; ++k)
+            {
+                pn[p][k] = _mm256_set1_ps(pl[k]);
+                pa[p][k] = _mm256_set1_ps(std::abs(pl[k]));
+            }
+            pw[p] = _mm256_set1_ps(pl.w);
+        }
+
+        const __m256 zero = _mm256_setzero_ps();
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m256 x = _mm256_loadu_ps(cx + i), y = _mm256_loadu_ps(cy + i), z = _mm256_loadu_ps(cz + i);
+            const __m256 hx = _mm256_loadu_ps(ex + i), hy = _mm256_loadu_ps(ey + i), hz = _mm256_loadu_ps(ez + i);
+
+            __m256 outside = zero;
+            for (int p = 0; p < 6; ++p)
+            {
+                __m256 d = _mm256_add_ps(_mm256_mul_ps(pn[p][0], x), pw[p]);
+                d = _mm256_add_ps(d, _mm256_mul_ps(pn[p][1], y));
+                d = _mm256_add_ps(d, _mm256_mul_ps(pn[p][2], z));
+                d = _mm256_add_ps(d, _mm256_mul_ps(pa[p][0], hx));
+                d = _mm256_add_ps(d, _mm256_mul_ps(pa[p][1], hy));
+                d = _mm256_add_ps(d, _mm256_mul_ps(pa[p][2], hz));
+                outside = _mm256_or_ps(outside, _mm256_cmp_ps(d, zero, _CMP_LT_OQ));
+            }
+
+            for (unsigned visible = ~unsigned(_mm256_movemask_ps(outside)) & 0xFFu; visible; visible &= visible - 1)
+                outIndices[count++] = uint32_t(i + std::countr_zero(visible));
+        }
+#elif defined(OME3D_CULL_SSE2)
+        // 1) Four boxes per iteration
+        __m128 pn[6][3], pa[6][3], pw[6];
+        for (int p = 0; p < 6; ++p)
+        {
+            const glm::vec4 &pl = frustum.planes[p];
+            for (int k = 0; k < 3; ++k)
+            {
+                pn[p][k] = _mm_set1_ps(pl[k]);
+                pa[p][k] = _mm_set1_ps(std::abs(pl[k]));
+            }
+            pw[p] = _mm_set1_ps(pl.w);
+        }
+
+        const __m128 zero = _mm_setzero_ps();
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128 x = _mm_loadu_ps(cx + i), y = _mm_loadu_ps(cy + i), z = _mm_loadu_ps(cz + i);
+            const __m128 hx = _mm_loadu_ps(ex + i), hy = _mm_loadu_ps(ey + i), hz = _mm_loadu_ps(ez + i);
+
+            __m128 outside = zero;
+            for (int p = 0; p < 6; ++p)
+            {
+                __m128 d = _mm_add_ps(_mm_mul_ps(pn[p][0], x), pw[p]);
+                d = _mm_add_ps(d, _mm_mul_ps(pn[p][1], y));
+                d = _mm_add_ps(d, _mm_mul_ps(pn[p][2], z));
+                d = _mm_add_ps(d, _mm_mul_ps(pa[p][0], hx));
+                d = _mm_add_ps(d, _mm_mul_ps(pa[p][1], hy));
+                d = _mm_add_ps(d, _mm_mul_ps(pa[p][2], hz));
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(d, zero));
+            }
+
+            for (unsigned visible = ~unsigned(_mm_movemask_ps(outside)) & 0xFu; visible; visible &= visible - 1)
+                outIndices[count++] = uint32_t(i + std::countr_zero(visible));
+        }
+#endif
+
+        // 2) Remainder (everything without SIMD)
+        for (; i < n; ++i)
+        {
+            bool inside = true;
+            for (const glm::vec4 &pl : frustum.planes)
+            {
+                const float d = pl.x * cx[i] + pl.y * cy[i] + pl.z * cz[i] + pl.w +
+                                std::abs(pl.x) * ex[i] + std::abs(pl.y) * ey[i] + std::abs(pl.z) * ez[i];
+                if (d < 0.0f)
+                {
+                    inside = false;
+                    break;
+                }
+            }
+            if (inside)
+                outIndices[count++] = uint32_t(i);
+        }
+        return count;
+    }
+
+} // namespace Core::MathUtils
@@ -0,0 +1,440 @@
+#include "render/DrawListBuilder.h"
+
+#include "render/Camera.h"
+#include "rhi/vk/gfx/Mesh.h"
+#include "rhi/vk/gfx/StreamingIndexBuffer.h"
+#include "core/Stopwatch.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace Render
+{
+    namespace
+    {
+        /// Largest scale factor of the upper 3x3 (bounding sphere radius / error scale in world).
+        float maxAxisScale(const glm::mat4 &m) noexcept
+        {
+            const float sx = glm::dot(glm::vec3(m[0]), glm::vec3(m[0]));
+            const float sy = glm::dot(glm::vec3(m[1]), glm::vec3(m[1]));
+            const float sz = glm::dot(glm::vec3(m[2]), glm::vec3(m[2]));
+            return std::sqrt(std::max(sx, std::max(sy, sz)));
+        }
+
+        /// Coarsest LOD whose projected error is <= limitPx.
+        uint32_t coarsestWithin(const Vk::Gfx::Mesh &mesh, float pxPerLocalUnit, float limitPx) noexcept
+        {
+            uint32_t best = 0;
+            for (uint32_t i = 1; i < mesh.lodCount(); ++i)
+            {
+                if (mesh.lod(i).error * pxPerLocalUnit > limitPx)
+                    break; // errors grow monotonically along the chain
+                best = i;
+            }
+            return best;
+        }
+
+        enum class SphereVsFrustum
+        {
+            Outside,
+            Intersecting,
+            Inside
+        };
+
+        SphereVsFrustum classifySphere(const Core::MathUtils::Frustum &frustum, const glm::vec3 &c, float r) noexcept
+        {
+            SphereVsFrustum result = SphereVsFrustum::Inside;
+            for (const glm::vec4 &p : frustum.planes)
+            {
+                const float d = glm::dot(glm::vec3(p), c) + p.w;
+                if (d < -r)
+                    return SphereVsFrustum::Outside;
+                if (d < r)
+                    result = SphereVsFrustum::Intersecting;
+            }
+            return result;
+        }
+
+        /// True if the upper 3x3 is a rotation times a uniform positive scale (normal cones stay valid).
+        bool preservesCones(const glm::mat4 &m) noexcept
+        {
+            const float sx = glm::dot(glm::vec3(m[0]), glm::vec3(m[0]));
+            const float sy = glm::dot(glm::vec3(m[1]), glm::vec3(m[1]));
+            const float sz = glm::dot(glm::vec3(m[2]), glm::vec3(m[2]));
+            const float lo = std::min(sx, std::min(sy, sz));
+            const float hi = std::max(sx, std::max(sy, sz));
+            return lo > 0.0f && hi <= lo * 1.002f && glm::determinant(glm::mat3(m)) > 0.0f;
+        }
+
+        // Draw order key, from the top: pipeline (2 bits) | material id | mesh id | depth.
+        // The id fields are as wide as the scene needs, so ids never alias; depth gets the rest.
+        constexpr uint32_t kStateBits = 62;
+        constexpr uint64_t kOpaquePipeline = uint64_t(0) << kStateBits; // the only pipeline today
+
+        /// Bits needed to store ids 0 .. count-1.
+        uint32_t idBits(std::size_t count) noexcept
+        {
+            return count > 1 ? static_cast<uint32_t>(std::bit_width(count - 1)) : 0u;
+        }
+    } // namespace
+
+    const std::vector<ObjectData> &DrawListBuilder::sceneObjects(const std::vector<Vk::Gfx::DrawItem> &sceneItems,
+                                                                 uint64_t sceneGeneration)
+    {
+        refreshBounds(sceneItems, sceneGeneration);
+        return sceneObjects_;
+    }
+
+    void DrawListBuilder::refreshBounds(const std::vector<Vk::Gfx::DrawItem> &sceneItems, uint64_t sceneGeneration)
+    {
+        if (boundsSource_ == sceneItems.data() && boundsCount_ == sceneItems.size() &&
+            boundsGeneration_ == sceneGeneration)
+            return;
+
+        worldBounds_.resize(sceneItems.size());
+        sceneObjects_.resize(sceneItems.size());
+        for (std::size_t i = 0; i < sceneItems.size(); ++i)
+        {
+            const Vk::Gfx::DrawItem &it = sceneItems[i];
+            sceneObjects_[i] = ObjectData{it.transform, glm::mat4(glm::transpose(glm::inverse(glm::mat3(it.transform))))};
+
+            // Items without a mesh keep an empty box at the origin (the recorder skips them anyway)
+            const Core::MathUtils::AABB box =
+                it.mesh ? Core::MathUtils::transformAABB({it.mesh->getMin(), it.mesh->getMax()}, it.transform)
+                        : Core::MathUtils::AABB{};
+            worldBounds_.set(i, box);
+        }
+
+        // Dense ids for the sort keys: materials in first-use order, meshes by geometry page
+        std::unordered_map<const Render::Material *, uint32_t> materialIds;
+        std::vector<const Vk::Gfx::Mesh *> meshes;
+        for (const Vk::Gfx::DrawItem &it : sceneItems)
+        {
+            materialIds.try_emplace(it.material, static_cast<uint32_t>(materialIds.size()));
+            meshes.push_back(it.mesh);
+        }
+        std::sort(meshes.begin(), meshes.end());
+        meshes.erase(std::unique(meshes.begin(), meshes.end()), meshes.end());
+        std::stable_sort(meshes.begin(), meshes.end(), [](const Vk::Gfx::Mesh *a, const Vk::Gfx::Mesh *b)
+                         { return (a ? a->vertexBuffer() : VK_NULL_HANDLE) < (b ? b->vertexBuffer() : VK_NULL_HANDLE); });
+
+        std::unordered_map<const Vk::Gfx::Mesh *, uint32_t> meshIds;
+        for (const Vk::Gfx::Mesh *mesh : meshes)
+            meshIds.emplace(mesh, static_cast<uint32_t>(meshIds.size()));
+
+        const uint32_t materialBits = idBits(materialIds.size());
+        const uint32_t meshBits = idBits(meshIds.size());
+        const uint32_t meshShift = kStateBits - materialBits - meshBits; // >= 0 below 2^31 materials and meshes
+        depthBits_ = std::min(meshShift, 32u);
+
+        sceneStateKeys_.resize(sceneItems.size());
+        for (std::size_t i = 0; i < sceneItems.size(); ++i)
+        {
+            const Vk::Gfx::DrawItem &it = sceneItems[i];
+            sceneStateKeys_[i] = kOpaquePipeline |
+                                 uint64_t(materialIds[it.material]) << (meshShift + meshBits) |
+                                 uint64_t(meshIds[it.mesh]) << meshShift;
+        }
+
+        boundsSource_ = sceneItems.data();
+        boundsCount_ = sceneItems.size();
+        boundsGeneration_ = sceneGeneration;
+    }
+
+    const std::vector<Vk::Gfx::DrawItem> &DrawListBuilder::build(const std::vector<Vk::Gfx::DrawItem> &sceneItems,
+                                                                 const Camera &camera,
+                                                                 float viewportHeight,
+                                                                 uint64_t sceneGeneration)
+    {
+        if (currentLod_.size() != sceneItems.size())
+            currentLod_.assign(sceneItems.size(), 0u);
+
+        stats_ = {};
+        stats_.items = static_cast<uint32_t>(sceneItems.size());
+
+        viewProj_ = camera.proj() * camera.view();
+        eye_ = camera.position();
+
+        // 1) Visibility: world bounds vs. frustum, SoA kernel; only survivors are recorded
+        Core::Stopwatch sw;
+        refreshBounds(sceneItems, sceneGeneration);
+        visibleItems_.resize(sceneItems.size());
+        std::size_t visibleCount = sceneItems.size();
+        if (visibilitySettings_.frustum)
+        {
+            visibleCount = Core::MathUtils::cullAABBs(Core::MathUtils::extractFrustum(viewProj_), worldBounds_,
+                                                      visibleItems_.data());
+        }
+        else
+        {
+            for (std::size_t i = 0; i < visibleCount; ++i)
+                visibleItems_[i] = static_cast<uint32_t>(i);
+        }
+        visibleItems_.resize(visibleCount);
+        stats_.visibilityMs = sw.elapsedMs();
+        stats_.itemsVisible = static_cast<uint32_t>(visibleCount);
+
+        items_.clear();
+        items_.reserve(visibleCount);
+        objects_.clear();
+        objects_.reserve(visibleCount);
+        for (uint32_t i : visibleItems_)
+        {
+            items_.push_back(sceneItems[i]);
+            objects_.push_back(sceneObjects_[i]);
+        }
+
+        // 2) Pixels per world unit at distance 1: (H / 2) / tan(fovY / 2) = (H / 2) * |P[1][1]|
+        const float pxAtUnitDistance = 0.5f * viewportHeight * std::abs(camera.proj()[1][1]);
+        const float minDistance = std::max(camera.zNear(), 1e-3f);
+        const glm::vec3 eye = eye_;
+
+        const LodSelectionSettings &ls = lodSettings_;
+        const float coarserLimit = ls.pixelThreshold * (1.0f - ls.hysteresis);
+        const float finerLimit = ls.pixelThreshold * (1.0f + ls.hysteresis);
+
+        for (size_t k = 0; k < items_.size(); ++k)
+        {
+            Vk::Gfx::DrawItem &it = items_[k];
+            const uint32_t i = visibleItems_[k]; // LOD state is kept per scene item
+            if (!it.mesh)
+                continue;
+
+            const Vk::Gfx::Mesh &mesh = *it.mesh;
+            uint32_t lod = std::min(currentLod_[i], mesh.lodCount() ? mesh.lodCount() - 1 : 0u);
+
+            if (!ls.enabled || mesh.lodCount() <= 1)
+            {
+                lod = 0;
+            }
+            else
+            {
+                // 3) Distance to the nearest point of the world bounding sphere
+                const float scale = maxAxisScale(it.transform);
+                const glm::vec3 localCenter = 0.5f * (mesh.getMin() + mesh.getMax());
+                const float radius = 0.5f * glm::length(mesh.getMax() - mesh.getMin()) * scale;
+                const glm::vec3 center = glm::vec3(it.transform * glm::vec4(localCenter, 1.0f));
+                const float distance = std::max(glm::length(center - eye) - radius, minDistance);
+
+                // 4) Local-space error -> pixels, then select with hysteresis
+                const float pxPerLocalUnit = pxAtUnitDistance * scale / distance;
+
+                const uint32_t coarser = coarsestWithin(mesh, pxPerLocalUnit, coarserLimit);
+                if (coarser > lod)
+                    lod = coarser;
+                else if (mesh.lod(lod).error * pxPerLocalUnit > finerLimit)
+                    lod = coarsestWithin(mesh, pxPerLocalUnit, ls.pixelThreshold);
+            }
+
+            currentLod_[i] = lod;
+            it.lod = lod;
+
+            // 5) Stats
+            if (mesh.lodCount() > 0)
+            {
+                stats_.trianglesFull += mesh.lod(0).indexCount / 3;
+                stats_.trianglesDrawn += mesh.lod(lod).indexCount / 3;
+            }
+            if (lod > 0)
+                ++stats_.itemsReduced;
+        }
+
+        // 6) Draw order: state key + squared distance of the bounds center (non-negative floats
+        //    compare like their bit patterns; only the top depthBits_ are kept when the ids need
+        //    more than 30 bits), stable radix sort, then permute items and objects
+        if (drawOrderSettings_.sortByState && items_.size() > 1)
+        {
+            Core::Stopwatch sortTimer;
+            const std::size_t count = items_.size();
+
+            sortEntries_.resize(count);
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                const uint32_t i = visibleItems_[k];
+                const glm::vec3 toCenter = glm::vec3(worldBounds_.cx[i], worldBounds_.cy[i], worldBounds_.cz[i]) - eye;
+                const uint32_t depth = std::bit_cast<uint32_t>(glm::dot(toCenter, toCenter));
+                sortEntries_[k] = Core::SortEntry{sceneStateKeys_[i] | uint64_t(depth) >> (32 - depthBits_), static_cast<uint32_t>(k)};
+            }
+            Core::radixSort(sortEntries_, sortScratch_);
+
+            sortedItems_.resize(count);
+            sortedObjects_.resize(count);
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                sortedItems_[k] = items_[sortEntries_[k].value];
+                sortedObjects_[k] = objects_[sortEntries_[k].value];
+            }
+            items_.swap(sortedItems_);
+            objects_.swap(sortedObjects_);
+
+            stats_.sortMs = sortTimer.elapsedMs();
+        }
+
+        // 7) Instancing: one item per run of equal mesh / material / LOD, drawing the run's objects
+        std::size_t drawCount = 0;
+        for (std::size_t k = 0; k < items_.size();)
+        {
+            Vk::Gfx::DrawItem &first = items_[k];
+            std::size_t end = k + 1;
+            if (drawOrderSettings_.instancing && first.mesh)
+            {
+                while (end < items_.size() && items_[end].mesh == first.mesh &&
+                       items_[end].material == first.material && items_[end].lod == first.lod)
+                    ++end;
+            }
+
+            first.firstInstance = static_cast<uint32_t>(k);
+            first.instanceCount = static_cast<uint32_t>(end - k);
+            items_[drawCount++] = first;
+            k = end;
+        }
+        items_.resize(drawCount);
+        stats_.draws = static_cast<uint32_t>(drawCount);
+
+        return items_;
+    }
+
+    void DrawListBuilder::cullClusters(Vk::Gfx::StreamingIndexBuffer &out, uint32_t slot)
+    {
+        Core::Stopwatch sw;
+        clusterStats_ = {};
+        visibleMeshlets_.clear();
+        visibleEnd_.assign(items_.size(), 0u);
+
+        const ClusterCullSettings &cs = clusterSettings_;
+        std::size_t totalIndices = 0;
+
+        // 1) Per item: collect the meshlets that survive the frustum and normal cone tests
+        for (size_t i = 0; i < items_.size(); ++i)
+        {
+            Vk::Gfx::DrawItem &it = items_[i];
+            it.clustered = false;
+
+            if (!it.mesh)
+            {
+                visibleEnd_[i] = static_cast<uint32_t>(visibleMeshlets_.size());
+                continue;
+            }
+
+            const Vk::Gfx::Mesh &mesh = *it.mesh;
+            const std::span<const Vk::Gfx::Mesh::Meshlet> meshlets = mesh.meshlets();
+
+            // Instanced items draw one index range for every instance: no per-item meshlet lists
+            if (!cs.enabled || it.lod != 0 || meshlets.empty() || it.instanceCount > 1)
+            {
+                if (mesh.lodCount() > 0)
+                    clusterStats_.trianglesSubmitted +=
+                        uint64_t(mesh.lod(std::min(it.lod, mesh.lodCount() - 1)).indexCount / 3) * it.instanceCount;
+                visibleEnd_[i] = static_cast<uint32_t>(visibleMeshlets_.size());
+                continue;
+            }
+
+            it.clustered = true;
+            ++clusterStats_.itemsClustered;
+            clusterStats_.clustersTested += meshlets.size();
+
+            // 1a) Frustum in mesh-local space (exact for local spheres under any affine transform);
+            //     the mesh's own sphere rejects or accepts everything at once when it can
+            const Core::MathUtils::Frustum planes = Core::MathUtils::extractFrustum(viewProj_ * it.transform);
+
+            const glm::vec3 meshCenter = 0.5f * (mesh.getMin() + mesh.getMax());
+            const float meshRadius = 0.5f * glm::length(mesh.getMax() - mesh.getMin());
+            const SphereVsFrustum whole = cs.frustum ? classifySphere(planes, meshCenter, meshRadius)
+                                                     : SphereVsFrustum::Inside;
+            if (whole == SphereVsFrustum::Outside)
+            {
+                visibleEnd_[i] = static_cast<uint32_t>(visibleMeshlets_.size());
+                continue;
+            }
+            const bool testFrustum = whole == SphereVsFrustum::Intersecting;
+
+            // 1b) Viewer in mesh-local space for the cone test
+            const bool testCones = cs.normalCones && preservesCones(it.transform);
+            const glm::vec3 localEye = testCones ? glm::vec3(glm::inverse(it.transform) * glm::vec4(eye_, 1.0f))
+                                                 : glm::vec3(0.0f);
+
+            const size_t itemBegin = visibleMeshlets_.size();
+            std::size_t itemIndices = 0;
+            for (uint32_t m = 0; m < meshlets.size(); ++m)
+            {
+                const Vk::Gfx::Mesh::Meshlet &ml = meshlets[m];
+
+                if (testFrustum && classifySphere(planes, ml.center, ml.radius) == SphereVsFrustum::Outside)
+                    continue;
+
+                // Back-facing cluster: every triangle faces away from the viewer
+                if (testCones && ml.coneCutoff < 1.0f)
+                {
+                    const glm::vec3 toCenter = ml.center - localEye;
+                    const float dist = glm::length(toCenter);
+                    if (glm::dot(toCenter, ml.coneAxis) >= ml.coneCutoff * dist + ml.radius)
+                        continue;
+                }
+
+                visibleMeshlets_.push_back(m);
+                itemIndices += ml.indexCount;
+            }
+
+            // Nothing culled: the mesh's own index buffer already holds exactly this
+            if (visibleMeshlets_.size() - itemBegin == meshlets.size())
+            {
+                visibleMeshlets_.resize(itemBegin);
+                it.clustered = false;
+                --clusterStats_.itemsClustered;
+                clusterStats_.clustersVisible += meshlets.size();
+                clusterStats_.trianglesSubmitted += itemIndices / 3;
+            }
+            else
+            {
+                totalIndices += itemIndices;
+            }
+            visibleEnd_[i] = static_cast<uint32_t>(visibleMeshlets_.size());
+        }
+
+        // 2) One reservation for the frame, then copy runs of adjacent meshlets
+        uint32_t *dst = totalIndices ? out.reserve(slot, totalIndices) : nullptr;
+        uint32_t cursor = 0;
+        uint32_t begin = 0;
+
+        for (size_t i = 0; i < items_.size(); ++i)
+        {
+            Vk::Gfx::DrawItem &it = items_[i];
+            const uint32_t end = visibleEnd_[i];
+            if (!it.clustered)
+            {
+                begin = end;
+                continue;
+            }
+
+            const std::span<const Vk::Gfx::Mesh::Meshlet> meshlets = it.mesh->meshlets();
+            const uint32_t *src = it.mesh->meshletIndices().data();
+
+            it.clusterFirstIndex = cursor;
+            for (uint32_t k = begin; k < end;)
+            {
+                const uint32_t runFirst = meshlets[visibleMeshlets_[k]].firstIndex;
+                uint32_t runEnd = runFirst + meshlets[visibleMeshlets_[k]].indexCount;
+                for (++k; k < end && meshlets[visibleMeshlets_[k]].firstIndex == runEnd; ++k)
+                    runEnd += meshlets[visibleMeshlets_[k]].indexCount;
+
+                std::memcpy(dst + cursor, src + runFirst, (runEnd - runFirst) * sizeof(uint32_t));
+                cursor += runEnd - runFirst;
+            }
+            it.clusterIndexCount = cursor - it.clusterFirstIndex;
+            begin = end;
+        }
+
+        out.flush(slot, totalIndices);
+
+        // 3) Stats
+        clusterStats_.clustersVisible += visibleMeshlets_.size();
+        clusterStats_.trianglesSubmitted += totalIndices / 3;
+        clusterStats_.cullMs = sw.elapsedMs();
+    }
+
+} // namespace Render
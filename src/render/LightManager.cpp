@@ -1,6 +1,7 @@
 #include "render/LightManager.h"
 
 #include "rhi/vk/DebugUtils.h"
+#include "rhi/vk/UploadContext.h"
 
 #include <algorithm>
 #include <array>
@@ -35,17 +36,14 @@ namespace Render
                               VMA_ALLOCATION_CREATE_MAPPED_BIT,
                           "LightingCountsUBO");
 
-        ssboDir_.create(allocator_, device_, sizeof(DirectionalLightGPU) * 1,
-                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                        VMA_MEMORY_USAGE_GPU_ONLY, 0, "SSBO_Directional");
+        ssboDir_.createDeviceLocal(allocator_, device_, sizeof(DirectionalLightGPU) * 1,
+                                   VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, "SSBO_Directional");
 
-        ssboPoint_.create(allocator_, device_, sizeof(PointLightGPU) * 1,
-                          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                          VMA_MEMORY_USAGE_GPU_ONLY, 0, "SSBO_Point");
+        ssboPoint_.createDeviceLocal(allocator_, device_, sizeof(PointLightGPU) * 1,
+                                     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, "SSBO_Point");
 
-        ssboSpot_.create(allocator_, device_, sizeof(SpotLightGPU) * 1,
-                         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                         VMA_MEMORY_USAGE_GPU_ONLY, 0, "SSBO_Spot");
+        ssboSpot_.createDeviceLocal(allocator_, device_, sizeof(SpotLightGPU) * 1,
+                                    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, "SSBO_Spot");
 
         // Allocate descriptor set
         VkDescriptorSetAllocateInfo ai{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
@@ -85,12 +83,10 @@ namespace Render
 
         VkDeviceSize newSize = std::max(minBytes, curr * 2 + 1024); // grow
         buf.destroy();
-        buf.create(allocator_, device_, newSize,
-                   usage,
-                   VMA_MEMORY_USAGE_GPU_ONLY, 0, debugName);
+        buf.createDeviceLocal(allocator_, device_, newSize, usage, debugName);
     }
 
-    void LightManager::upload(VkCommandPool cmdPool, VkQueue queue,
+    void LightManager::upload(Vk::UploadContext &upload,
                               const glm::vec3 &ambientRGB, uint32_t flags)
     {
         // (1) UBO counts/ambient
@@ -109,17 +105,8 @@ namespace Render
             ensureBufferCapacity(ssboDir_, bytes,
                                  VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                                  "SSBO_Directional");
-            // transient staging copy into GPU-only SSBO
-            Vk::Gfx::Buffer staging;
-            staging.create(allocator_, device_, bytes,
-                           VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                           VMA_MEMORY_USAGE_CPU_TO_GPU,
-                           VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
-                               VMA_ALLOCATION_CREATE_MAPPED_BIT,
-                           "SSBO_Directional Staging");
-            staging.upload(dir.data(), (size_t)bytes);
-            Vk::Gfx::Buffer::copyBuffer(device_, cmdPool, queue, staging.get(), ssboDir_.get(), bytes);
-            staging.destroy();
+            // direct write on UMA / ReBAR, otherwise a staged copy recorded into the upload batch
+            upload.writeBuffer(ssboDir_, dir.data(), bytes);
         }
 
         // (3) Point lights -> SSBO
@@ -129,16 +116,7 @@ namespace Render
             ensureBufferCapacity(ssboPoint_, bytes,
                                  VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                                  "SSBO_Point");
-            Vk::Gfx::Buffer staging;
-            staging.create(allocator_, device_, bytes,
-                           VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                           VMA_MEMORY_USAGE_CPU_TO_GPU,
-                           VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
-                               VMA_ALLOCATION_CREATE_MAPPED_BIT,
-                           "SSBO_Point Staging");
-            staging.upload(point.data(), (size_t)bytes);
-            Vk::Gfx::Buffer::copyBuffer(device_, cmdPool, queue, staging.get(), ssboPoint_.get(), bytes);
-            staging.destroy();
+            upload.writeBuffer(ssboPoint_, point.data(), bytes);
         }
 
         // (4) Spot lights -> SSBO
@@ -148,16 +126,7 @@ namespace Render
             ensureBufferCapacity(ssboSpot_, bytes,
                                  VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                                  "SSBO_Spot");
-            Vk::Gfx::Buffer staging;
-            staging.create(allocator_, device_, bytes,
-                           VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                           VMA_MEMORY_USAGE_CPU_TO_GPU,
-                           VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
-                               VMA_ALLOCATION_CREATE_MAPPED_BIT,
-                           "SSBO_Spot Staging");
-            staging.upload(spot.data(), (size_t)bytes);
-            Vk::Gfx::Buffer::copyBuffer(device_, cmdPool, queue, staging.get(), ssboSpot_.get(), bytes);
-            staging.destroy();
+            upload.writeBuffer(ssboSpot_, spot.data(), bytes);
         }
 
         // Descriptors still valid (we didn't change buffer handles if capacity was enough).
@@ -1,6 +1,7 @@
 #include "render/Scene.h"
 
 #include "core/Logger.h"
+#include "core/Stopwatch.h"
 #include "rhi/vk/Common.h"
 #include "rhi/vk/gfx/Vertex.h"
 #include "rhi/vk/gfx/utils/MeshUtils.h"
@@ -8,6 +9,7 @@
 #include <glm/glm.hpp>
 #include <cmath>
 #include <algorithm>
+#include <optional>
 
 using Core::Logger;
 using Core::LogLevel;
@@ -17,21 +19,55 @@ using Vk::Gfx::Utils::computeWorldAABB;
 namespace Render
 {
     void Scene::loadModel(const std::string &gltfPath,
-                          VmaAllocator allocator,
-                          VkDevice device,
-                          VkCommandPool cmdPool,
-                          VkQueue queue,
+                          Vk::UploadContext &upload,
+                          Vk::Gfx::GeometryArena &geometry,
                           MaterialSystem &materialSystem)
     {
-        // 1) Parse glTF -> MeshData list (CPU side)
-        std::vector<Asset::MeshData> meshDatas = Asset::GltfLoader::loadMeshes(gltfPath);
+        Core::Stopwatch loadTimer;
+
+        Asset::Processing::OptimizeSettings opt{};
+        opt.optimizeCache = true;
+        opt.optimizeOverdraw = true;
+        opt.overdrawThreshold = 1.05f;
+        opt.optimizeFetch = true;
+        opt.generateLods = true;  // full detail stays LOD 0; coarser levels are picked per frame
+        opt.buildMeshlets = true; // LOD 0 clusters are culled per frame on the CPU
+
+        // 1) Try the processed-mesh cache first (warm start: streams are memory-mapped)
+        std::optional<Asset::MeshCache> cache;
+        std::optional<std::uint64_t> cacheKey;
+        if (!meshCacheDir_.empty())
+        {
+            cache.emplace(meshCacheDir_);
+            cacheKey = Asset::MeshCache::computeKey(gltfPath, opt);
+        }
+
+        std::optional<Asset::CachedMeshes> cached;
+        if (cache && cacheKey)
+            cached = cache->load(*cacheKey);
 
-        // 2) Run mesh optimization passes
+        Asset::ModelData model;
+        std::vector<Asset::MeshDataView> meshViews;
+        std::vector<Asset::MeshInstance> instances;
+
+        if (cached)
+        {
+            meshViews = cached->meshes();
+            instances = cached->instances();
+        }
+        else
         {
+            // 2) Cold path: parse glTF -> unique MeshData + instances (CPU side)
+            model = Asset::GltfLoader::loadModel(gltfPath);
+            std::vector<Asset::MeshData> &meshDatas = model.meshes;
+
+            // 3) Run mesh optimization passes
             struct MeshStats
             {
                 size_t vertices{};
-                size_t indices{};
+                size_t indices{}; // LOD 0 only
+                size_t lods{};
+                size_t meshlets{};
                 size_t triangles() const { return indices / 3; }
             };
 
@@ -41,49 +77,61 @@ namespace Render
                 for (auto &m : mds)
                 {
                     s.vertices += m.positions.size() / 3;
-                    s.indices += m.indices.size();
+                    s.indices += m.baseIndexCount();
+                    s.lods += std::max<size_t>(1, m.lods.size());
+                    s.meshlets += m.meshlets.size();
                 }
                 return s;
             };
 
             MeshStats before = collectStats(meshDatas);
 
-            Asset::Processing::OptimizeSettings opt{};
-            opt.optimizeCache = true;
-            opt.optimizeOverdraw = true;
-            opt.overdrawThreshold = 1.05f;
-            opt.optimizeFetch = true;
-            opt.simplify = true;            // optional LOD-like simplification
-            opt.simplifyTargetRatio = 0.6f; // ~60% triangles
-            opt.simplifyError = 1e-2f;
-
+            Asset::Processing::OptimizeStats optStats{};
             for (auto &md : meshDatas)
             {
-                Asset::Processing::OptimizeMeshInPlace(md, opt);
+                Asset::Processing::OptimizeStats meshStats{};
+                Asset::Processing::OptimizeMeshInPlace(md, opt, &meshStats);
+                optStats.accumulate(meshStats);
             }
 
             MeshStats after = collectStats(meshDatas);
             CORE_LOG_DEBUG(
                 "Mesh optimize: vertices " + std::to_string(before.vertices) + " -> " + std::to_string(after.vertices) +
                 ", indices " + std::to_string(before.indices) + " -> " + std::to_string(after.indices) +
-                ", tris " + std::to_string(before.triangles()) + " -> " + std::to_string(after.triangles()));
+                ", tris " + std::to_string(before.triangles()) + " -> " + std::to_string(after.triangles()) +
+                ", LOD levels " + std::to_string(after.lods) + ", meshlets " + std::to_string(after.meshlets));
+            CORE_LOG_DEBUG(
+                "Mesh optimize: " + std::to_string(optStats.totalMs()) + " ms (remap " + std::to_string(optStats.remapMs) +
+                ", vcache " + std::to_string(optStats.cacheMs) + ", overdraw " + std::to_string(optStats.overdrawMs) +
+                ", fetch " + std::to_string(optStats.fetchMs) + ", simplify " + std::to_string(optStats.simplifyMs) +
+                ", meshlets " + std::to_string(optStats.meshletMs) + ", lods " + std::to_string(optStats.lodMs) +
+                "), peak scratch " + std::to_string(optStats.peakScratchBytes / 1024) + " KiB");
+
+            if (cache && cacheKey)
+                cache->store(*cacheKey, model);
+
+            meshViews.assign(meshDatas.begin(), meshDatas.end());
+            instances = model.instances;
         }
 
-        // 3) Upload each mesh to GPU (DEVICE_LOCAL via transient staging)
+        const double cpuMs = loadTimer.elapsedMs();
+
+        // 4) Upload each unique mesh to GPU once (a range of the shared geometry arena)
         gpuMeshes_.clear();
         drawItems_.clear();
+        ++generation_;
 
-        gpuMeshes_.reserve(meshDatas.size());
-        drawItems_.reserve(meshDatas.size());
+        gpuMeshes_.reserve(meshViews.size());
+        drawItems_.reserve(meshViews.size());
 
-        for (auto &md : meshDatas)
+        for (const auto &md : meshViews)
         {
             // Build interleaved vertex buffer compatible with Vk::Gfx::Vertex
             std::vector<Vk::Gfx::Vertex> vertices;
-            const size_t vertCount = md.positions.size() / 3;
-            const bool hasNormals = (md.normals.size() == md.positions.size());
-            const bool hasUVs = (md.texcoords.size() == vertCount * 2);
-            const bool hasTangents = (md.tangents.size() == vertCount * 4);
+            const size_t vertCount = md.vertexCount();
+            const bool hasNormals = md.hasNormals();
+            const bool hasUVs = md.hasTexcoord0();
+            const bool hasTangents = md.hasTangents();
 
             vertices.reserve(vertCount);
 
@@ -121,22 +169,42 @@ namespace Render
                 vertices.push_back(v);
             }
 
-            // Create GPU mesh (allocates VkBuffers via VMA and uploads via staging)
+            // Create GPU mesh (suballocated from the arena, copies recorded into the upload batch)
             auto meshGpu = std::make_unique<Vk::Gfx::Mesh>();
             meshGpu->create(
-                allocator,
-                device,
-                cmdPool,
-                queue,
+                upload,
+                geometry,
                 vertices,
                 md.indices,
-                md.localTransform,
-                gltfPath);
+                md.localTransform);
+
+            // LOD chain: index ranges into the mesh's indices just uploaded
+            std::vector<Vk::Gfx::Mesh::Lod> lods;
+            lods.reserve(md.lods.size());
+            for (const Asset::MeshLod &l : md.lods)
+                lods.push_back({l.firstIndex, l.indexCount, l.error});
+            meshGpu->setLods(lods);
+
+            // Meshlets: bounds + a CPU copy of their LOD 0 indices for per-frame cluster culling
+            std::vector<Vk::Gfx::Mesh::Meshlet> meshlets;
+            meshlets.reserve(md.meshlets.size());
+            for (const Asset::Meshlet &m : md.meshlets)
+            {
+                meshlets.push_back({m.firstIndex, m.indexCount,
+                                    glm::vec3(m.center[0], m.center[1], m.center[2]), m.radius,
+                                    glm::vec3(m.coneAxis[0], m.coneAxis[1], m.coneAxis[2]), m.coneCutoff});
+            }
+            meshGpu->setMeshlets(meshlets, md.indices.first(md.baseIndexCount()));
 
             gpuMeshes_.push_back(std::move(meshGpu));
         }
 
-        // 4) Create a material and assign it to all draw items
+        CORE_LOG_INFO("Scene: loaded '" + gltfPath + "' (" + (cached ? "warm, mesh cache hit" : "cold") +
+                      ") in " + std::to_string(loadTimer.elapsedMs()) + " ms (CPU side " +
+                      std::to_string(cpuMs) + " ms, " + std::to_string(meshViews.size()) + " meshes, " +
+                      std::to_string(instances.size()) + " instances)");
+
+        // 5) Create a material and assign it to all draw items
         // NOTE: for now, paths are hardcoded; later read them from glTF materials.
         Render::MaterialDesc matDesc{};
         matDesc.baseColorPath = "assets/makarov/textures/makarov_baseColor.png";
@@ -147,24 +215,26 @@ namespace Render
         materials_.clear();
         materials_.push_back(matShared);
 
-        // 5) Build draw list (mesh + material)
+        // 6) Build draw list: one item per instance (shared mesh + material, own transform)
         drawItems_.clear();
-        drawItems_.reserve(gpuMeshes_.size());
-        for (auto &mPtr : gpuMeshes_)
+        ++generation_;
+        drawItems_.reserve(instances.size());
+        for (const auto &inst : instances)
         {
             drawItems_.push_back(Vk::Gfx::DrawItem{
-                /*mesh*/ mPtr.get(),
-                /*material*/ matShared.get()});
+                /*mesh*/ gpuMeshes_[inst.meshIndex].get(),
+                /*material*/ matShared.get(),
+                /*transform*/ inst.transform});
         }
 
-        // 6) Compute world AABB for camera framing
-        {
-            std::vector<const Vk::Gfx::Mesh *> tmpList;
-            tmpList.reserve(gpuMeshes_.size());
-            for (auto &mPtr : gpuMeshes_)
-                tmpList.push_back(mPtr.get());
-            worldAaBb_ = computeWorldAABB(tmpList);
-        }
+        // 7) Compute world AABB for camera framing
+        worldAaBb_ = computeWorldAABB(drawItems_);
+    }
+
+    void Scene::setTransform(std::size_t index, const glm::mat4 &transform)
+    {
+        drawItems_.at(index).transform = transform;
+        ++generation_;
     }
 
 } // namespace Render
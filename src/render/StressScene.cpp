@@ -0,0 +1,139 @@
+#include "render/StressScene.h"
+
+#include "rhi/vk/gfx/utils/MeshUtils.h"
+#include "core/Logger.h"
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cmath>
+#include <string>
+
+namespace Render
+{
+    // ------------------------------------------------------------
+    // Flat-shaded prism: one quad per side + two triangle-fan caps.
+    // Vertex layout matches Vk::Gfx::Vertex: pos, normal, uv, tangent.w
+    // ------------------------------------------------------------
+    void StressScene::appendPrism(uint32_t sides, float radius, float y0, float y1,
+                                  std::vector<Vk::Gfx::Vertex> &verts,
+                                  std::vector<uint32_t> &idx)
+    {
+        auto put = [&](const glm::vec3 &pos, const glm::vec3 &n, const glm::vec3 &t, const glm::vec2 &uv)
+        {
+            Vk::Gfx::Vertex v{};
+            v.pos = pos;
+            v.normal = n;
+            v.uv = uv;
+            v.tangent = glm::vec4(t, 1.0f);
+            verts.push_back(v);
+            return static_cast<uint32_t>(verts.size() - 1);
+        };
+
+        auto corner = [&](uint32_t i, float y)
+        {
+            const float a = glm::two_pi<float>() * float(i % sides) / float(sides);
+            return glm::vec3(radius * std::cos(a), y, radius * std::sin(a));
+        };
+
+        // 1) Sides (counter-clockwise seen from outside)
+        for (uint32_t i = 0; i < sides; ++i)
+        {
+            const glm::vec3 a0 = corner(i, y0), a1 = corner(i + 1, y0);
+            const glm::vec3 b0 = corner(i, y1), b1 = corner(i + 1, y1);
+            const glm::vec3 t = glm::normalize(a1 - a0);
+            const glm::vec3 n = glm::normalize(glm::cross(glm::vec3(0.0f, 1.0f, 0.0f), t));
+
+            const uint32_t v0 = put(a0, n, t, {0.0f, 0.0f});
+            const uint32_t v1 = put(a1, n, t, {1.0f, 0.0f});
+            const uint32_t v2 = put(b1, n, t, {1.0f, 1.0f});
+            const uint32_t v3 = put(b0, n, t, {0.0f, 1.0f});
+            idx.insert(idx.end(), {v0, v2, v1, v0, v3, v2});
+        }
+
+        // 2) Caps (fans around the first corner)
+        for (const bool top : {false, true})
+        {
+            const float y = top ? y1 : y0;
+            const glm::vec3 n(0.0f, top ? 1.0f : -1.0f, 0.0f);
+            const uint32_t base = static_cast<uint32_t>(verts.size());
+            for (uint32_t i = 0; i < sides; ++i)
+            {
+                const glm::vec3 p = corner(i, y);
+                put(p, n, {1.0f, 0.0f, 0.0f}, {0.5f + 0.5f * p.x / radius, 0.5f + 0.5f * p.z / radius});
+            }
+            for (uint32_t i = 1; i + 1 < sides; ++i)
+            {
+                if (top)
+                    idx.insert(idx.end(), {base, base + i + 1, base + i});
+                else
+                    idx.insert(idx.end(), {base, base + i, base + i + 1});
+            }
+        }
+    }
+
+    void StressScene::build(Vk::UploadContext &upload,
+                            Vk::Gfx::GeometryArena &geometry,
+                            MaterialSystem &materialSystem,
+                            uint32_t objectCount)
+    {
+        gpuMeshes_.clear();
+        drawItems_.clear();
+        ++generation_;
+        materials_.clear();
+
+        // -----------------------------
+        // 1) Geometry: hex-head bolt and hex nut
+        // -----------------------------
+        std::vector<Vk::Gfx::Vertex> vtx;
+        std::vector<uint32_t> idx;
+
+        appendPrism(6, 0.30f, 0.0f, 0.20f, vtx, idx);  // head
+        appendPrism(16, 0.12f, 0.20f, 1.20f, vtx, idx); // shaft
+        auto boltMesh = std::make_unique<Vk::Gfx::Mesh>();
+        boltMesh->create(upload, geometry, vtx, idx);
+
+        vtx.clear();
+        idx.clear();
+        appendPrism(6, 0.30f, 0.0f, 0.25f, vtx, idx);
+        auto nutMesh = std::make_unique<Vk::Gfx::Mesh>();
+        nutMesh->create(upload, geometry, vtx, idx);
+
+        // -----------------------------------
+        // 2) One untextured steel material (fallback textures, factors only)
+        // -----------------------------------
+        MaterialDesc steel{};
+        steel.params.baseColorFactor = {0.62f, 0.63f, 0.66f, 1.0f};
+        steel.params.metallicFactor = 1.0f;
+        steel.params.roughnessFactor = 0.35f;
+        steel.params.uvTiling = {1.0f, 1.0f};
+        std::shared_ptr<Material> material = materialSystem.createMaterial(steel);
+        materials_.push_back(material);
+
+        // -----------------------------------
+        // 3) Square grid, 1 m apart, each object turned a little differently
+        // -----------------------------------
+        const uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(double(objectCount))));
+        const float half = 0.5f * float(side - 1);
+
+        drawItems_.reserve(objectCount);
+        for (uint32_t i = 0; i < objectCount; ++i)
+        {
+            const glm::vec3 pos(float(i % side) - half, 0.0f, float(i / side) - half);
+            const glm::mat4 transform = glm::rotate(glm::translate(glm::mat4(1.0f), pos),
+                                                    0.37f * float(i), glm::vec3(0.0f, 1.0f, 0.0f));
+            const Vk::Gfx::Mesh *mesh = (i % 4 == 3) ? nutMesh.get() : boltMesh.get();
+            drawItems_.push_back(Vk::Gfx::DrawItem{mesh, material.get(), transform});
+        }
+
+        gpuMeshes_.push_back(std::move(boltMesh));
+        gpuMeshes_.push_back(std::move(nutMesh));
+
+        // -----------------------------------
+        // 4) World AABB for cameras
+        // -----------------------------------
+        worldAaBb_ = Vk::Gfx::Utils::computeWorldAABB(drawItems_);
+
+        CORE_LOG_INFO("StressScene: " + std::to_string(objectCount) + " objects, 2 meshes, 1 material");
+    }
+}
@@ -103,15 +103,14 @@ namespace Render
             outIdx = {0, 2, 1, 0, 3, 2};
     }
 
-    void WorkshopScene::build(VmaAllocator allocator,
-                              VkDevice device,
-                              VkCommandPool cmdPool,
-                              VkQueue queue,
+    void WorkshopScene::build(Vk::UploadContext &upload,
+                              Vk::Gfx::GeometryArena &geometry,
                               MaterialSystem &materialSystem)
     {
         // Clear any previous GPU content
         gpuMeshes_.clear();
         drawItems_.clear();
+        ++generation_;
         materials_.clear();
 
         // -----------------------------
@@ -128,17 +127,17 @@ namespace Render
         // Floor at y=0
         makePlaneXZ(roomHalfX, roomHalfZ, 0.0f, vtx, idx, /*flipWinding=*/true);
         auto floorMesh = std::make_unique<Vk::Gfx::Mesh>();
-        floorMesh->create(allocator, device, cmdPool, queue, vtx, idx, glm::mat4(1.0f), "Workshop_Floor");
+        floorMesh->create(upload, geometry, vtx, idx, glm::mat4(1.0f));
 
         // Left wall at x = -roomHalfX, facing center (+X normal? we want it to face inward)
         makeWallYZ(-roomHalfX, wallHalfY, roomHalfZ, vtx, idx, /*faceToCenter=*/true /*normal +X*/);
         auto leftWallMesh = std::make_unique<Vk::Gfx::Mesh>();
-        leftWallMesh->create(allocator, device, cmdPool, queue, vtx, idx, glm::mat4(1.0f), "Workshop_Wall_L");
+        leftWallMesh->create(upload, geometry, vtx, idx, glm::mat4(1.0f));
 
         // Right wall at x = +roomHalfX, facing center (-X normal)
         makeWallYZ(+roomHalfX, wallHalfY, roomHalfZ, vtx, idx, /*faceToCenter=*/false /*normal -X*/);
         auto rightWallMesh = std::make_unique<Vk::Gfx::Mesh>();
-        rightWallMesh->create(allocator, device, cmdPool, queue, vtx, idx, glm::mat4(1.0f), "Workshop_Wall_R");
+        rightWallMesh->create(upload, geometry, vtx, idx, glm::mat4(1.0f));
 
         // (Optional) Add a small box at center to catch highlights
         // Skipped for brevity—floor + walls are enough to validate lights.
@@ -164,10 +163,13 @@ namespace Render
 
         floorMat.params.uvTiling = {4.0f, 4.0f};
 
-        auto floorMtl = materialSystem.createMaterial(floorMat);
-
         MaterialDesc wallMat = floorMat; // same set is OK for testing
-        auto wallMtl = materialSystem.createMaterial(wallMat);
+
+        // Both in one batch: identical descs collapse to a single Material (images decoded/uploaded once)
+        const MaterialDesc descs[] = {floorMat, wallMat};
+        auto created = materialSystem.createMaterials(descs);
+        auto floorMtl = created[0];
+        auto wallMtl = created[1];
 
         materials_.push_back(floorMtl);
         materials_.push_back(wallMtl);
@@ -175,9 +177,9 @@ namespace Render
         // -----------------------------------
         // 3) Register draw items
         // -----------------------------------
-        drawItems_.push_back(Vk::Gfx::DrawItem{floorMesh.get(), floorMtl.get()});
-        drawItems_.push_back(Vk::Gfx::DrawItem{leftWallMesh.get(), wallMtl.get()});
-        drawItems_.push_back(Vk::Gfx::DrawItem{rightWallMesh.get(), wallMtl.get()});
+        drawItems_.push_back(Vk::Gfx::DrawItem{floorMesh.get(), floorMtl.get(), floorMesh->getLocalTransform()});
+        drawItems_.push_back(Vk::Gfx::DrawItem{leftWallMesh.get(), wallMtl.get(), leftWallMesh->getLocalTransform()});
+        drawItems_.push_back(Vk::Gfx::DrawItem{rightWallMesh.get(), wallMtl.get(), rightWallMesh->getLocalTransform()});
 
         // Keep ownership of meshes in the Scene
         gpuMeshes_.push_back(std::move(floorMesh));
@@ -187,10 +189,6 @@ namespace Render
         // -----------------------------------
         // 4) Compute world AABB for cameras
         // -----------------------------------
-        std::vector<const Vk::Gfx::Mesh *> tmp;
-        tmp.reserve(gpuMeshes_.size());
-        for (auto &m : gpuMeshes_)
-            tmp.push_back(m.get());
-        worldAaBb_ = Vk::Gfx::Utils::computeWorldAABB(tmp);
+        worldAaBb_ = Vk::Gfx::Utils::computeWorldAABB(drawItems_);
     }
 }
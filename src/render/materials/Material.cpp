@@ -1,12 +1,16 @@
 #include "render/materials/Material.h"
 #include "rhi/vk/Common.h" // VK_CHECK + logger
+#include "asset/cache/TextureCookCache.h"
+#include "asset/io/ImageDecode.h"
+#include "asset/processing/TextureCook.h"
+#include "core/Stopwatch.h"
+#include "core/StringUtils.h" // Core::Str::assetNameFromPath
 
+#include <array>
 #include <cstring>
-
-#ifdef OME3D_USE_STB
-// Texture2D::loadFromFile() already uses stb; we don't need to include here.
-#include "stb_image.h"
-#endif
+#include <optional>
+#include <span>
+#include <vector>
 
 namespace Render
 {
@@ -34,41 +38,418 @@ namespace Render
         vmaUnmapMemory(allocator_, uboAlloc_);
     }
 
+    // --- texture sources ----------------------------------------------------
+
+    namespace
+    {
+        using Asset::Processing::TextureCodec;
+
+        /// Images are decoded with the file's own channel count; slots pick the channels they store.
+        constexpr int kNative = 0;
+
+        /// TextureCache / cooked-file tag of a packed metallic/roughness map: AO went into its R channel (ARM).
+        constexpr uint32_t kTagPackedAO = 1u;
+
+        /// TextureCookCache variants: how an entry's source files are combined.
+        constexpr uint64_t kVariantFile = 0;   // one file
+        constexpr uint64_t kVariantPacked = 1; // metallic + roughness (+ AO) -> MR / ARM
+        constexpr uint64_t kVariantNormal = 2; // one normal map: RG direction + B Toksvig variance per mip
+
+        /// Where a stored channel comes from: a channel of the source image, or a constant.
+        enum Gather : int8_t
+        {
+            kR = 0,
+            kG = 1,
+            kB = 2,
+            kA = 3,
+            k0 = -1,
+            k1 = -2,
+        };
+
+        /// GPU storage of a texture slot.
+        struct SlotFormat
+        {
+            VkFormat plain;               // uncompressed storage (R8 / R8G8 / RGBA8)
+            TextureCodec codec;           // block-compressed storage (cooking on a BC-capable device)
+            std::array<int8_t, 4> gather; // stored R, G, B, A <- source channel
+            bool mrSwizzle;               // stores (roughness, metallic) in R, G; the view returns them as .g, .b
+            bool normalMap;               // cooked with CookNormalMap (B = per-mip Toksvig variance)
+        };
+
+        constexpr SlotFormat kColorSlot{VK_FORMAT_R8G8B8A8_SRGB, TextureCodec::BC7, {kR, kG, kB, kA}, false, false};
+        // Z rebuilt in frag.glsl; B carries the cooked variance, so three channels (BC7, same size as BC5)
+        constexpr SlotFormat kNormalSlot{VK_FORMAT_R8G8B8A8_UNORM, TextureCodec::BC7, {kR, kG, k0, k1}, false, true};
+        constexpr SlotFormat kMRSlot{VK_FORMAT_R8G8_UNORM, TextureCodec::BC5, {kG, kB, k0, k1}, true, false};       // glTF: G=rough, B=metal
+        constexpr SlotFormat kARMSlot{VK_FORMAT_R8G8B8A8_UNORM, TextureCodec::BC7, {kR, kG, kB, k1}, false, false}; // RGB8 isn't reliably sampleable
+        constexpr SlotFormat kMaskSlot{VK_FORMAT_R8_UNORM, TextureCodec::BC4, {kR, k0, k0, k1}, false, false};      // AO, read as .r
+
+        bool cooks(const TextureCooking *cooking)
+        {
+            return cooking && cooking->cache;
+        }
+
+        bool isSrgb(SlotFormat slot)
+        {
+            return slot.plain == VK_FORMAT_R8G8B8A8_SRGB;
+        }
+
+        uint32_t plainChannels(SlotFormat slot)
+        {
+            uint32_t dim = 1, bytes = 4;
+            Vk::Gfx::Texture2D::blockInfo(slot.plain, dim, bytes);
+            return bytes;
+        }
+
+        VkComponentMapping swizzleOf(SlotFormat slot)
+        {
+            if (!slot.mrSwizzle)
+                return {};
+            return {VK_COMPONENT_SWIZZLE_ZERO, VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_ONE};
+        }
+
+        TextureCodec codecOf(const TextureCooking &cooking, SlotFormat slot)
+        {
+            if (cooking.blockCompression)
+                return slot.codec;
+            switch (plainChannels(slot))
+            {
+            case 1:
+                return TextureCodec::R8;
+            case 2:
+                return TextureCodec::RG8;
+            default:
+                return TextureCodec::RGBA8;
+            }
+        }
+
+        /// Vulkan format a slot ends up in (also part of its TextureCache key).
+        VkFormat formatOf(const TextureCooking *cooking, SlotFormat slot)
+        {
+            if (!cooks(cooking) || !cooking->blockCompression)
+                return slot.plain;
+
+            switch (slot.codec)
+            {
+            case TextureCodec::BC7:
+                return isSrgb(slot) ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+            case TextureCodec::BC5:
+                return VK_FORMAT_BC5_UNORM_BLOCK;
+            case TextureCodec::BC4:
+                return VK_FORMAT_BC4_UNORM_BLOCK;
+            default:
+                return slot.plain;
+            }
+        }
+
+        /// Cooked-file key of a slot; std::nullopt when cooking is off or a source can't be read.
+        std::optional<uint64_t> cookKey(const TextureCooking *cooking, SlotFormat slot,
+                                        std::span<const std::string> sources, uint64_t variant)
+        {
+            if (!cooks(cooking))
+                return std::nullopt;
+
+            uint32_t gather = 0;
+            std::memcpy(&gather, slot.gather.data(), sizeof(gather));
+            return cooking->cache->computeKey(sources, codecOf(*cooking, slot), isSrgb(slot), variant << 32 | gather);
+        }
+
+        /**
+         * @brief Texels of a decoded image rearranged as @p channels of @p gather per texel.
+         *        Gray (+ alpha) images repeat their luminance in R, G and B.
+         */
+        std::vector<uint8_t> gatherTexels(const unsigned char *src, int components, uint32_t w, uint32_t h,
+                                          const std::array<int8_t, 4> &gather, uint32_t channels)
+        {
+            int from[4];
+            uint8_t constant[4];
+            for (uint32_t c = 0; c < channels; ++c)
+            {
+                int g = gather[c];
+                if (g == kA && (components == 1 || components == 3))
+                    g = k1; // no alpha in the file: opaque
+                else if (g >= 0 && components <= 2)
+                    g = (g == kA) ? 1 : 0;
+                from[c] = g;
+                constant[c] = (g == k1) ? 255 : 0;
+            }
+
+            std::vector<uint8_t> out(size_t(w) * h * channels);
+            for (size_t i = 0; i < size_t(w) * h; ++i)
+                for (uint32_t c = 0; c < channels; ++c)
+                    out[i * channels + c] = from[c] >= 0 ? src[i * components + from[c]] : constant[c];
+            return out;
+        }
+
+        /// Metallic + roughness maps are packed on the CPU (MR / ARM) instead of loading an MR file.
+        bool packsSeparateMR(const MaterialDesc &desc)
+        {
+            return desc.mrPath.empty() && !desc.metallicPath.empty() && !desc.roughnessPath.empty();
+        }
+
+        /// Packed maps with an AO file need three channels (ARM); without one, two do (MR).
+        SlotFormat packedSlot(const MaterialDesc &desc)
+        {
+            return desc.occlusionPath.empty() ? kMRSlot : kARMSlot;
+        }
+
+        std::vector<std::string> packedSources(const MaterialDesc &desc)
+        {
+            std::vector<std::string> sources{desc.metallicPath, desc.roughnessPath};
+            if (!desc.occlusionPath.empty())
+                sources.push_back(desc.occlusionPath);
+            return sources;
+        }
+
+        /// Cooked-file variant of a single-file slot.
+        uint64_t fileVariant(SlotFormat slot)
+        {
+            return slot.normalMap ? kVariantNormal : kVariantFile;
+        }
+
+        TextureKey fileKey(const std::string &path, const TextureCooking *cooking, SlotFormat slot)
+        {
+            return TextureKey{path, formatOf(cooking, slot), /*mips*/ true, swizzleOf(slot)};
+        }
+
+        /// MR / ARM map built from separate metallic, roughness (and AO) files.
+        TextureKey packedKey(const MaterialDesc &desc, const TextureCooking *cooking)
+        {
+            const SlotFormat slot = packedSlot(desc);
+            return TextureKey{"pack:m=" + desc.metallicPath + "|r=" + desc.roughnessPath + "|ao=" + desc.occlusionPath,
+                              formatOf(cooking, slot), true, swizzleOf(slot)};
+        }
+
+        /// Texture lookups and uploads of one Material::create() call.
+        class TextureBuilder
+        {
+        public:
+            TextureBuilder(TextureCache &cache, Vk::UploadContext &upload, VkSampler sampler,
+                           const Asset::ImageDecodeBatch &images, TextureCooking *cooking)
+                : cache_(cache), upload_(upload), sampler_(sampler), images_(images), cooking_(cooking)
+            {
+            }
+
+            /// Decoded image (nullptr if missing / undecodable). Planning skips maps with a cooked
+            /// entry; should that entry then fail to load, the image is decoded here after all.
+            const Asset::DecodedImage *optionalImage(const std::string &path)
+            {
+                if (path.empty())
+                    return nullptr;
+
+                const Asset::DecodedImage *img = images_.find(path, kNative);
+                if (!img)
+                {
+                    auto &batch = late_.emplace_back(std::make_unique<Asset::ImageDecodeBatch>());
+                    batch->request(path, kNative);
+                    batch->decodeAll(1);
+                    img = batch->find(path, kNative);
+                }
+                return (img && img->ok()) ? img : nullptr;
+            }
+
+            /// Image the material cannot do without (throws like Texture2D::loadFromFile did).
+            const Asset::DecodedImage &requireImage(const std::string &path)
+            {
+                const Asset::DecodedImage *img = optionalImage(path);
+                if (!img)
+                    throw std::runtime_error("Failed to load image via stb: " + path);
+                return *img;
+            }
+
+            /// Texture read from its cooked file; null when cooking is off or there is no valid entry.
+            std::shared_ptr<Vk::Gfx::Texture2D> loadCooked(const TextureKey &key, std::optional<uint64_t> cookedKey,
+                                                           const std::string &sourcePath, uint32_t *tag = nullptr)
+            {
+                if (!cookedKey)
+                    return nullptr;
+
+                std::optional<Asset::Processing::CookedTexture> cooked = cooking_->cache->load(*cookedKey);
+                if (!cooked)
+                    return nullptr;
+
+                ++cooking_->loaded;
+                if (tag)
+                    *tag = cooked->tag;
+                return uploadCooked(key, *cooked, sourcePath);
+            }
+
+            /**
+             * @brief Texture for a cache miss built from decoded texels (@p components per texel):
+             *        cooked (and stored under @p cookedKey) when cooking, else uploaded in the slot's
+             *        plain format with GPU mips. Identical resident content is aliased instead.
+             */
+            std::shared_ptr<Vk::Gfx::Texture2D> build(const TextureKey &key, SlotFormat slot,
+                                                      std::optional<uint64_t> cookedKey, uint32_t tag,
+                                                      const unsigned char *src, int components, uint32_t w, uint32_t h,
+                                                      const std::string &sourcePath)
+            {
+                if (cookedKey)
+                {
+                    Core::Stopwatch sw;
+                    const std::vector<uint8_t> rgba = gatherTexels(src, components, w, h, slot.gather, 4);
+                    Asset::Processing::CookedTexture cooked =
+                        slot.normalMap ? Asset::Processing::CookNormalMap(rgba.data(), w, h, codecOf(*cooking_, slot))
+                                       : Asset::Processing::CookTexture(rgba.data(), w, h, codecOf(*cooking_, slot), isSrgb(slot));
+                    cooked.tag = tag;
+                    cooking_->cache->store(*cookedKey, cooked);
+                    ++cooking_->cooked;
+                    cooking_->cookMs += sw.elapsedMs();
+                    return uploadCooked(key, cooked, sourcePath);
+                }
+
+                const uint32_t channels = plainChannels(slot);
+                const std::vector<uint8_t> texels = gatherTexels(src, components, w, h, slot.gather, channels);
+                const uint64_t hash = cache_.hashPixels(texels.data(), texels.size(), w, h);
+                if (auto shared = cache_.acquireByContent(key, hash, tag))
+                    return shared;
+
+                const std::string debugName = Core::Str::assetNameFromPath(sourcePath);
+                auto tex = std::make_shared<Vk::Gfx::Texture2D>();
+                tex->createFromPixels(upload_, texels.data(), w, h, key.mips, key.format, debugName.c_str(), key.swizzle);
+                tex->setSampler(sampler_);
+                cache_.insert(key, hash, tag, tex);
+                return tex;
+            }
+
+            /// Cached texture of one image file: resident, cooked on disk, or built from its pixels.
+            std::shared_ptr<Vk::Gfx::Texture2D> file(const std::string &path, SlotFormat slot)
+            {
+                const TextureKey key = fileKey(path, cooking_, slot);
+                if (auto tex = cache_.acquire(key))
+                    return tex;
+
+                const std::string sources[] = {path};
+                const std::optional<uint64_t> cookedKey = cookKey(cooking_, slot, sources, fileVariant(slot));
+                if (auto tex = loadCooked(key, cookedKey, path))
+                    return tex;
+
+                const Asset::DecodedImage &img = requireImage(path);
+                return build(key, slot, cookedKey, 0, img.pixels.get(), img.components, img.width, img.height, img.path);
+            }
+
+        private:
+            /// Upload a cooked chain as is (one staging copy, no blits).
+            std::shared_ptr<Vk::Gfx::Texture2D> uploadCooked(const TextureKey &key,
+                                                             const Asset::Processing::CookedTexture &cooked,
+                                                             const std::string &sourcePath)
+            {
+                const uint64_t hash = cache_.hashPixels(cooked.data.data(), cooked.data.size(), cooked.width, cooked.height);
+                if (auto shared = cache_.acquireByContent(key, hash, cooked.tag))
+                    return shared;
+
+                std::vector<Vk::UploadContext::ImageLevel> levels;
+                levels.reserve(cooked.levels.size());
+                for (const Asset::Processing::CookedLevel &l : cooked.levels)
+                    levels.push_back({l.offset, l.bytes, l.width, l.height});
+
+                const std::string debugName = Core::Str::assetNameFromPath(sourcePath);
+                auto tex = std::make_shared<Vk::Gfx::Texture2D>();
+                tex->createFromLevels(upload_, cooked.data.data(), levels.data(), uint32_t(levels.size()),
+                                      cooked.width, cooked.height, key.format, debugName.c_str(), key.swizzle);
+                tex->setSampler(sampler_);
+                cache_.insert(key, hash, cooked.tag, tex);
+                return tex;
+            }
+
+            TextureCache &cache_;
+            Vk::UploadContext &upload_;
+            VkSampler sampler_;
+            const Asset::ImageDecodeBatch &images_;
+            TextureCooking *cooking_;
+            std::vector<std::unique_ptr<Asset::ImageDecodeBatch>> late_; // one per late image: find() results stay valid
+        };
+    } // namespace
+
+    void Material::requestImages(const MaterialDesc &desc, Asset::ImageDecodeBatch &batch, const TextureCache *cache,
+                                 const TextureCooking *cooking)
+    {
+        // Maps resident in the cache or cooked on disk are neither decoded nor uploaded again
+        auto ready = [&](const TextureKey &key, SlotFormat slot, std::span<const std::string> sources,
+                         uint64_t variant, uint32_t *tag)
+        {
+            if (cache && cache->contains(key, tag))
+                return true;
+            const std::optional<uint64_t> cooked = cookKey(cooking, slot, sources, variant);
+            return cooked && cooking->cache->contains(*cooked, tag);
+        };
+        auto want = [&](const std::string &path, SlotFormat slot)
+        {
+            const std::string sources[] = {path};
+            if (!path.empty() && !ready(fileKey(path, cooking, slot), slot, sources, fileVariant(slot), nullptr))
+                batch.request(path, kNative);
+        };
+
+        want(desc.baseColorPath, kColorSlot);
+        want(desc.normalPath, kNormalSlot);
+        want(desc.emissivePath, kColorSlot);
+
+        if (!packsSeparateMR(desc))
+        {
+            want(desc.mrPath, kMRSlot);
+            want(desc.occlusionPath, kMaskSlot);
+            return;
+        }
+
+        // Packed into ARM (or MR) in create(); AO gets its own R8 map if it can't be packed
+        uint32_t tag = 0;
+        if (ready(packedKey(desc, cooking), packedSlot(desc), packedSources(desc), kVariantPacked, &tag))
+        {
+            if (!(tag & kTagPackedAO))
+                want(desc.occlusionPath, kMaskSlot);
+            return;
+        }
+        batch.request(desc.metallicPath, kNative);
+        batch.request(desc.roughnessPath, kNative);
+        batch.request(desc.occlusionPath, kNative);
+    }
+
+    uint64_t Material::textureBytes() const noexcept
+    {
+        uint64_t bytes = 0;
+        for (const auto *tex : {&baseColor_, &normal_, &mr_, &occlusion_, &emissive_})
+            if (*tex)
+                bytes += (*tex)->sizeBytes();
+        return bytes;
+    }
+
     // --- main ---------------------------------------------------------------
 
     void Material::create(VmaAllocator allocator, VkDevice dev,
                           VkDescriptorPool pool, VkDescriptorSetLayout layout,
-                          VkCommandPool uploadPool,
-                          VkQueue uploadQueue,
+                          Vk::UploadContext &upload,
+                          Vk::Gfx::SamplerCache &samplers,
                           const MaterialDesc &desc,
                           // fallback textures (not owned)
                           Vk::Gfx::Texture2D *white,
                           Vk::Gfx::Texture2D *flatNormal,
-                          Vk::Gfx::Texture2D *black)
+                          Vk::Gfx::Texture2D *black,
+                          const Asset::ImageDecodeBatch *decoded,
+                          TextureCache *cache,
+                          TextureCooking *cooking)
     {
         destroy();
 
         allocator_ = allocator;
         device_ = dev;
 
-        // Load textures if paths are provided, otherwise use fallbacks.
-        auto loadTex = [&](std::unique_ptr<Vk::Gfx::Texture2D> &dst,
-                           const std::string &path,
-                           VkFormat fmt)
+        // Without a shared cache the textures are simply private to this material
+        TextureCache privateCache;
+        if (!cache)
+            cache = &privateCache;
+
+        // Decoding normally happened on worker threads (MaterialSystem::createMaterials);
+        // standalone callers decode here. Only the uploads below touch the render thread.
+        Asset::ImageDecodeBatch local;
+        if (!decoded)
         {
-            if (path.empty())
-                return false;
-            dst = std::make_unique<Vk::Gfx::Texture2D>();
-            dst->loadFromFile(allocator_, device_, /*cmdPool*/ uploadPool, /*queue*/ uploadQueue,
-                              path, /*genMips*/ true, fmt); // NOTE: if you need cmdPool/queue, pass via MaterialSystem
-            return true;
-        };
+            requestImages(desc, local, cache, cooking);
+            local.decodeAll();
+            decoded = &local;
+        }
+        // Every material map samples the same way: one shared sampler (the view clamps each texture's mips)
+        TextureBuilder textures(*cache, upload, samplers.get(Vk::Gfx::SamplerDesc{}), *decoded, cooking);
 
-        // IMPORTANT (TEMPORARY):
-        // If your Texture2D::loadFromFile() requires a valid command pool/queue,
-        // create materials via MaterialSystem that passes those in. For brevity,
-        // this snippet assumes Texture2D has a file-based helper like your createFromRGBA8
-        // variant. If not, refactor to call createFromRGBA8 with loaded pixels.
+        // Texture uploads are only recorded here; they land once the caller's upload batch is flushed.
 
         // Bind views/samplers to fallback first
         albedoView_ = white->view();
@@ -87,130 +468,95 @@ namespace Render
         // BaseColor (sRGB)
         if (!desc.baseColorPath.empty())
         {
-            baseColor_ = std::make_unique<Vk::Gfx::Texture2D>();
-            baseColor_->loadFromFile(allocator_, device_,
-                                     /*cmdPool*/ uploadPool, /*queue*/ uploadQueue,
-                                     desc.baseColorPath, /*genMips*/ true, VK_FORMAT_R8G8B8A8_SRGB);
+            baseColor_ = textures.file(desc.baseColorPath, kColorSlot);
             albedoView_ = baseColor_->view();
             albedoSampler_ = baseColor_->sampler();
             flags |= 1u;
         }
 
-        // Normal (UNORM)
+        // Normal (RG direction + B variance when cooked, UNORM)
         if (!desc.normalPath.empty())
         {
-            normal_ = std::make_unique<Vk::Gfx::Texture2D>();
-            normal_->loadFromFile(allocator_, device_, uploadPool, uploadQueue,
-                                  desc.normalPath, true, VK_FORMAT_R8G8B8A8_UNORM);
+            normal_ = textures.file(desc.normalPath, kNormalSlot);
             normalView_ = normal_->view();
             normalSampler_ = normal_->sampler();
             flags |= 2u;
         }
 
-        // MetallicRoughness (UNORM) — B=metallic, G=roughness
+        // MetallicRoughness (UNORM) — the view returns G=roughness, B=metallic
         bool hasARM = false;
         if (!desc.mrPath.empty())
         {
-            mr_ = std::make_unique<Vk::Gfx::Texture2D>();
-            mr_->loadFromFile(allocator_, device_, uploadPool, uploadQueue,
-                              desc.mrPath, true, VK_FORMAT_R8G8B8A8_UNORM);
+            mr_ = textures.file(desc.mrPath, kMRSlot);
             mrView_ = mr_->view();
             mrSampler_ = mr_->sampler();
             flags |= 4u;
         }
-        else if (!desc.metallicPath.empty() && !desc.roughnessPath.empty())
+        else if (packsSeparateMR(desc))
         {
-#ifdef OME3D_USE_STB
-            int wM = 0, hM = 0, nM = 0;
-            int wR = 0, hR = 0, nR = 0;
-            int wA = 0, hA = 0, nA = 0;
-
-            unsigned char *mData = stbi_load(desc.metallicPath.c_str(), &wM, &hM, &nM, 1);
-            unsigned char *rData = stbi_load(desc.roughnessPath.c_str(), &wR, &hR, &nR, 1);
-            unsigned char *aData = nullptr;
-            if (!desc.occlusionPath.empty())
-                aData = stbi_load(desc.occlusionPath.c_str(), &wA, &hA, &nA, 1);
-
-            const bool mrSame = (mData && rData && wM == wR && hM == hR);
-            const bool aoSame = (aData && wA == wR && hA == hR);
+            const TextureKey key = packedKey(desc, cooking);
+            uint32_t tag = 0;
+            mr_ = cache->acquire(key, &tag);
 
-            if (mrSame && aoSame)
+            std::optional<uint64_t> cookedKey;
+            if (!mr_)
             {
-                // === Пакуем ARM: R=AO, G=Roughness, B=Metallic ===
-                const int w = wR, h = hR;
-                std::vector<uint8_t> arm(size_t(w) * h * 4);
-                for (int i = 0; i < w * h; ++i)
-                {
-                    arm[4 * i + 0] = aData[i]; // AO
-                    arm[4 * i + 1] = rData[i]; // Rough
-                    arm[4 * i + 2] = mData[i]; // Metal
-                    arm[4 * i + 3] = 255;
-                }
-
-                mr_ = std::make_unique<Vk::Gfx::Texture2D>();
-                mr_->createFromRGBA8(allocator_, device_, uploadPool, uploadQueue,
-                                     arm.data(), w, h, /*genMips*/ true, VK_FORMAT_R8G8B8A8_UNORM);
-                mrView_ = mr_->view();
-                mrSampler_ = mr_->sampler();
-                flags |= 4u;  // has MR/ARM
-                flags |= 32u; // is ARM
-                hasARM = true;
+                cookedKey = cookKey(cooking, packedSlot(desc), packedSources(desc), kVariantPacked);
+                mr_ = textures.loadCooked(key, cookedKey, desc.roughnessPath, &tag);
             }
-            else if (mrSame)
+
+            if (!mr_)
             {
-                // === Собираем MR без AO (G=Roughness, B=Metallic). AO загрузим отдельно ===
-                const int w = wR, h = hR;
-                std::vector<uint8_t> mrg(size_t(w) * h * 4);
-                for (int i = 0; i < w * h; ++i)
+                const Asset::DecodedImage *m = textures.optionalImage(desc.metallicPath);
+                const Asset::DecodedImage *r = textures.optionalImage(desc.roughnessPath);
+                const Asset::DecodedImage *a = textures.optionalImage(desc.occlusionPath);
+
+                const bool mrSame = (m && r && m->width == r->width && m->height == r->height);
+                const bool aoSame = (mrSame && a && a->width == r->width && a->height == r->height);
+
+                if (mrSame)
                 {
-                    mrg[4 * i + 0] = 0;        // R (пусто)
-                    mrg[4 * i + 1] = rData[i]; // G = Rough
-                    mrg[4 * i + 2] = mData[i]; // B = Metal
-                    mrg[4 * i + 3] = 255;
+                    // ARM: R=AO, G=Roughness, B=Metallic (first channel of each input).
+                    // Without a matching AO map R stays empty (plain MR).
+                    const uint32_t w = r->width, h = r->height;
+                    const size_t mStep = size_t(m->components), rStep = size_t(r->components);
+                    const size_t aStep = aoSame ? size_t(a->components) : 0;
+                    const unsigned char *mData = m->pixels.get();
+                    const unsigned char *rData = r->pixels.get();
+                    const unsigned char *aData = aoSame ? a->pixels.get() : nullptr;
+
+                    std::vector<uint8_t> packed(size_t(w) * h * 4);
+                    for (size_t i = 0; i < size_t(w) * h; ++i)
+                    {
+                        packed[4 * i + 0] = aData ? aData[i * aStep] : 0; // AO
+                        packed[4 * i + 1] = rData[i * rStep];             // Rough
+                        packed[4 * i + 2] = mData[i * mStep];             // Metal
+                        packed[4 * i + 3] = 255;
+                    }
+
+                    tag = aoSame ? kTagPackedAO : 0u;
+                    mr_ = textures.build(key, packedSlot(desc), cookedKey, tag, packed.data(), 4, w, h, desc.roughnessPath);
                 }
+                // else: M/R sizes differ, no compositing; the default binds stay.
+            }
 
-                mr_ = std::make_unique<Vk::Gfx::Texture2D>();
-                mr_->createFromRGBA8(allocator_, device_, uploadPool, uploadQueue,
-                                     mrg.data(), w, h, /*genMips*/ true, VK_FORMAT_R8G8B8A8_UNORM);
+            if (mr_)
+            {
                 mrView_ = mr_->view();
                 mrSampler_ = mr_->sampler();
-                flags |= 4u; // has MR (НЕ ARM)
-                // flags |= 32u; // НЕ ставим isARM
-
-                // AO — отдельной текстурой, если есть путь
-                if (!desc.occlusionPath.empty())
+                flags |= 4u; // has MR/ARM
+                if (tag & kTagPackedAO)
                 {
-                    occlusion_ = std::make_unique<Vk::Gfx::Texture2D>();
-                    occlusion_->loadFromFile(allocator_, device_, uploadPool, uploadQueue,
-                                             desc.occlusionPath, true, VK_FORMAT_R8G8B8A8_UNORM);
-                    aoView_ = occlusion_->view();
-                    aoSampler_ = occlusion_->sampler();
-                    flags |= 8u; // has AO
+                    flags |= 32u; // is ARM
+                    hasARM = true;
                 }
             }
-            else
-            {
-                // Размеры M/R не совпали — откажемся от композитинга.
-                // Просто загрузим MR из файла (если есть) ИЛИ оставим fallbacks.
-                // (Можно также логнуть предупреждение.)
-                // Здесь ничего не меняем: останутся дефолтные бинды.
-            }
-
-            if (mData)
-                stbi_image_free(mData);
-            if (rData)
-                stbi_image_free(rData);
-            if (aData)
-                stbi_image_free(aData);
-#endif
         }
 
-        // AO (UNORM)
+        // AO (R, UNORM) unless it was packed into ARM
         if (!desc.occlusionPath.empty() && !hasARM)
         {
-            occlusion_ = std::make_unique<Vk::Gfx::Texture2D>();
-            occlusion_->loadFromFile(allocator_, device_, uploadPool, uploadQueue,
-                                     desc.occlusionPath, true, VK_FORMAT_R8G8B8A8_UNORM);
+            occlusion_ = textures.file(desc.occlusionPath, kMaskSlot);
             aoView_ = occlusion_->view();
             aoSampler_ = occlusion_->sampler();
             flags |= 8u;
@@ -219,9 +565,7 @@ namespace Render
         // Emissive (sRGB)
         if (!desc.emissivePath.empty())
         {
-            emissive_ = std::make_unique<Vk::Gfx::Texture2D>();
-            emissive_->loadFromFile(allocator_, device_, uploadPool, uploadQueue,
-                                    desc.emissivePath, true, VK_FORMAT_R8G8B8A8_SRGB);
+            emissive_ = textures.file(desc.emissivePath, kColorSlot);
             emissiveView_ = emissive_->view();
             emissiveSampler_ = emissive_->sampler();
             flags |= 16u;
@@ -1,12 +1,17 @@
 #include "render/materials/MaterialSystem.h"
 #include "rhi/vk/Common.h"
+#include "asset/cache/TextureCookCache.h"
+#include "asset/io/ImageDecode.h"
+
+#include <string>
 
 namespace Render
 {
 
     void MaterialSystem::init(VmaAllocator allocator, VkDevice dev,
                               VkDescriptorSetLayout materialLayout,
-                              uint32_t maxMaterials)
+                              uint32_t maxMaterials,
+                              float maxAnisotropy)
     {
         shutdown();
 
@@ -28,6 +33,7 @@ namespace Render
 
         VK_CHECK(vkCreateDescriptorPool(device_, &ci, nullptr, &pool_));
 
+        samplers_.init(device_, maxAnisotropy);
         createFallbacks();
     }
 
@@ -41,6 +47,10 @@ namespace Render
             pool_ = VK_NULL_HANDLE;
         }
 
+        materialsByDesc_.clear();
+        textures_.prune();
+        samplers_.destroy();
+
         layout_ = VK_NULL_HANDLE;
         device_ = VK_NULL_HANDLE;
         allocator_ = VK_NULL_HANDLE;
@@ -48,49 +58,143 @@ namespace Render
 
     std::shared_ptr<Material> MaterialSystem::createMaterial(const MaterialDesc &desc)
     {
-        if (uploadPool_ == VK_NULL_HANDLE || uploadQueue_ == VK_NULL_HANDLE)
+        return createMaterials(std::span<const MaterialDesc>(&desc, 1)).front();
+    }
+
+    std::vector<std::shared_ptr<Material>> MaterialSystem::createMaterials(std::span<const MaterialDesc> descs)
+    {
+        if (!upload_)
+        {
+            throw std::runtime_error("MaterialSystem: upload context not set");
+        }
+
+        for (auto it = materialsByDesc_.begin(); it != materialsByDesc_.end();)
+            it = it->second.expired() ? materialsByDesc_.erase(it) : std::next(it);
+
+        // 1) Identical descs collapse to one Material (alive from earlier, or first of this batch)
+        std::vector<std::shared_ptr<Material>> out(descs.size());
+        std::vector<std::string> keys(descs.size());
+        std::map<std::string, std::size_t> firstInBatch;
+        std::vector<std::size_t> toCreate;
+        for (std::size_t i = 0; i < descs.size(); ++i)
         {
-            throw std::runtime_error("MaterialSystem: upload pool/queue not set");
+            ++materialLookups_;
+            keys[i] = descKey(descs[i]);
+
+            if (const auto it = materialsByDesc_.find(keys[i]); it != materialsByDesc_.end())
+                out[i] = it->second.lock();
+            if (out[i] || !firstInBatch.emplace(keys[i], i).second)
+            {
+                ++materialHits_;
+                continue;
+            }
+            toCreate.push_back(i);
         }
 
-        auto mat = std::make_shared<Material>();
-        mat->create(allocator_, device_,
-                    /*descPool*/ pool_,
-                    /*layout*/ layout_,
-                    /*upload*/ uploadPool_,
-                    uploadQueue_,
-                    desc,
-                    white_.get(), flatNormal_.get(), black_.get());
-        return mat;
+        // 2) Decode every image not already resident, on worker threads (CPU only, no Vulkan calls)
+        Asset::ImageDecodeBatch images;
+        for (std::size_t i : toCreate)
+            Material::requestImages(descs[i], images, &textures_, &cooking_);
+        images.decodeAll(/*threads*/ 0);
+
+        // 3) Record uploads (cache misses only) + descriptor writes on this thread
+        uint64_t createdBytes = 0;
+        for (std::size_t i : toCreate)
+        {
+            auto mat = std::make_shared<Material>();
+            mat->create(allocator_, device_,
+                        /*descPool*/ pool_,
+                        /*layout*/ layout_,
+                        *upload_,
+                        samplers_,
+                        descs[i],
+                        white_.get(), flatNormal_.get(), black_.get(),
+                        &images, &textures_, &cooking_);
+            createdBytes += mat->textureBytes();
+            materialsByDesc_[keys[i]] = mat;
+            out[i] = std::move(mat);
+        }
+        for (std::size_t i = 0; i < descs.size(); ++i)
+        {
+            if (!out[i])
+                out[i] = out[firstInBatch.at(keys[i])];
+        }
+
+        const TextureCacheStats st = cacheStats();
+        CORE_LOG_INFO("MaterialSystem: " + std::to_string(descs.size()) + " materials (" +
+                      std::to_string(descs.size() - toCreate.size()) + " shared), textures: " +
+                      std::to_string(st.uploads) + " uploaded, " + std::to_string(st.pathHits + st.contentHits) +
+                      " cache hits, " + std::to_string(st.bytesSaved >> 20) + " MiB saved");
+        if (!toCreate.empty())
+            CORE_LOG_INFO("MaterialSystem: " + std::to_string((createdBytes / toCreate.size()) >> 10) +
+                          " KiB of textures per new material");
+        if (cooking_.cache)
+            CORE_LOG_INFO("MaterialSystem: cooked textures: " + std::to_string(st.cookedLoads) + " loaded, " +
+                          std::to_string(st.cooked) + " cooked (" + std::to_string(int(st.cookMs)) + " ms), " +
+                          std::to_string(st.bytesResident >> 10) + " KiB resident");
+        return out;
     }
 
-    void MaterialSystem::setUploadCmd(VkCommandPool pool, VkQueue queue)
+    TextureCacheStats MaterialSystem::cacheStats() const
     {
+        TextureCacheStats s = textures_.stats();
+        s.materialLookups = materialLookups_;
+        s.materialHits = materialHits_;
+        s.cookedLoads = cooking_.loaded;
+        s.cooked = cooking_.cooked;
+        s.cookMs = cooking_.cookMs;
+        s.uniqueSamplers = samplers_.size();
+        s.samplerRequests = samplers_.requests();
+        return s;
+    }
 
-        uploadPool_ = pool;
-        uploadQueue_ = queue;
+    void MaterialSystem::setTextureCooking(const std::filesystem::path &directory, bool blockCompression)
+    {
+        cookCache_ = directory.empty() ? nullptr : std::make_unique<Asset::TextureCookCache>(directory);
+        cooking_.cache = cookCache_.get();
+        cooking_.blockCompression = blockCompression;
+    }
+
+    std::string MaterialSystem::descKey(const MaterialDesc &desc)
+    {
+        // Paths + raw params (MaterialParams has explicit padding members only)
+        std::string key;
+        for (const std::string *path : {&desc.baseColorPath, &desc.normalPath, &desc.mrPath, &desc.metallicPath,
+                                        &desc.roughnessPath, &desc.occlusionPath, &desc.heightPath, &desc.emissivePath})
+        {
+            key += *path;
+            key += '\x1f';
+        }
+        key.append(reinterpret_cast<const char *>(&desc.params), sizeof(MaterialParams));
+        return key;
     }
 
     void MaterialSystem::createFallbacks()
     {
-        // Safety: must be set via setUploadCmd() before init()
-        if (uploadPool_ == VK_NULL_HANDLE || uploadQueue_ == VK_NULL_HANDLE)
+        // Safety: must be set via setUploadContext() before init()
+        if (!upload_)
         {
-            throw std::runtime_error("MaterialSystem: upload pool/queue not set (call setUploadCmd before init)");
+            throw std::runtime_error("MaterialSystem: upload context not set (call setUploadContext before init)");
         }
 
         // 1×1 RGBA pixels
         const uint8_t whitePix[4] = {255, 255, 255, 255};
         const uint8_t blackPix[4] = {0, 0, 0, 255};
-        const uint8_t flatNormalPix[4] = {128, 128, 255, 255}; // (0.5,0.5,1)
+        const uint8_t flatNormalPix[4] = {128, 128, 0, 255}; // (0,0,1), no Toksvig variance
 
         white_ = std::make_unique<Vk::Gfx::Texture2D>();
         black_ = std::make_unique<Vk::Gfx::Texture2D>();
         flatNormal_ = std::make_unique<Vk::Gfx::Texture2D>();
 
-        white_->createFromRGBA8(allocator_, device_, uploadPool_, uploadQueue_, whitePix, 1, 1, true, VK_FORMAT_R8G8B8A8_SRGB);
-        black_->createFromRGBA8(allocator_, device_, uploadPool_, uploadQueue_, blackPix, 1, 1, true, VK_FORMAT_R8G8B8A8_UNORM);
-        flatNormal_->createFromRGBA8(allocator_, device_, uploadPool_, uploadQueue_, flatNormalPix, 1, 1, true, VK_FORMAT_R8G8B8A8_UNORM);
+        white_->createFromRGBA8(*upload_, whitePix, 1, 1, true, VK_FORMAT_R8G8B8A8_SRGB);
+        black_->createFromRGBA8(*upload_, blackPix, 1, 1, true, VK_FORMAT_R8G8B8A8_UNORM);
+        flatNormal_->createFromRGBA8(*upload_, flatNormalPix, 1, 1, true, VK_FORMAT_R8G8B8A8_UNORM);
+
+        // Same state as material maps: the fallbacks add no samplers of their own
+        const VkSampler sampler = samplers_.get(Vk::Gfx::SamplerDesc{});
+        white_->setSampler(sampler);
+        black_->setSampler(sampler);
+        flatNormal_->setSampler(sampler);
     }
 
     void MaterialSystem::destroyFallbacks()
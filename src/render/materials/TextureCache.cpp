@@ -0,0 +1,108 @@
+#include "render/materials/TextureCache.h"
+#include "core/Hash.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Render
+{
+    std::shared_ptr<Vk::Gfx::Texture2D> TextureCache::acquire(const TextureKey &key, uint32_t *tag)
+    {
+        ++stats_.lookups;
+
+        const auto it = entries_.find(key);
+        if (it == entries_.end())
+            return nullptr;
+
+        std::shared_ptr<Vk::Gfx::Texture2D> tex = it->second.texture.lock();
+        if (!tex)
+            return nullptr;
+
+        if (tag)
+            *tag = it->second.tag;
+        ++stats_.pathHits;
+        stats_.bytesSaved += tex->sizeBytes();
+        return tex;
+    }
+
+    bool TextureCache::contains(const TextureKey &key, uint32_t *tag) const
+    {
+        const auto it = entries_.find(key);
+        if (it == entries_.end() || it->second.texture.expired())
+            return false;
+        if (tag)
+            *tag = it->second.tag;
+        return true;
+    }
+
+    std::shared_ptr<Vk::Gfx::Texture2D> TextureCache::acquireByContent(const TextureKey &key, uint64_t contentHash,
+                                                                       uint32_t tag)
+    {
+        if (!contentHashing_ || contentHash == 0)
+            return nullptr;
+
+        const auto it = byContent_.find(ContentKey{contentHash, key.format, key.mips, key.swizzle});
+        if (it == byContent_.end())
+            return nullptr;
+
+        const auto owner = entries_.find(it->second);
+        std::shared_ptr<Vk::Gfx::Texture2D> tex =
+            owner != entries_.end() ? owner->second.texture.lock() : nullptr;
+        if (!tex)
+            return nullptr;
+
+        // Same pixels under a new key: alias it so the next lookup is a plain path hit
+        entries_[key] = Entry{tex, contentHash, tag};
+        ++stats_.contentHits;
+        stats_.bytesSaved += tex->sizeBytes();
+        return tex;
+    }
+
+    void TextureCache::insert(const TextureKey &key, uint64_t contentHash, uint32_t tag,
+                              const std::shared_ptr<Vk::Gfx::Texture2D> &texture)
+    {
+        prune();
+
+        entries_[key] = Entry{texture, contentHash, tag};
+        if (contentHashing_ && contentHash != 0)
+            byContent_[ContentKey{contentHash, key.format, key.mips, key.swizzle}] = key;
+        ++stats_.uploads;
+    }
+
+    uint64_t TextureCache::hashPixels(const void *pixels, std::size_t bytes, uint32_t width, uint32_t height) const
+    {
+        if (!contentHashing_ || !pixels)
+            return 0;
+
+        const uint64_t h = Core::Hash::hash64(pixels, bytes, uint64_t(width) << 32 | height);
+        return h != 0 ? h : 1; // 0 means "not hashed"
+    }
+
+    void TextureCache::prune()
+    {
+        for (auto it = entries_.begin(); it != entries_.end();)
+            it = it->second.texture.expired() ? entries_.erase(it) : std::next(it);
+
+        for (auto it = byContent_.begin(); it != byContent_.end();)
+            it = entries_.count(it->second) ? std::next(it) : byContent_.erase(it);
+    }
+
+    TextureCacheStats TextureCache::stats() const
+    {
+        TextureCacheStats s = stats_;
+
+        // Aliased keys share a texture: count each resident texture once
+        std::vector<const Vk::Gfx::Texture2D *> seen;
+        for (const auto &[key, entry] : entries_)
+        {
+            const std::shared_ptr<Vk::Gfx::Texture2D> tex = entry.texture.lock();
+            if (!tex || std::find(seen.begin(), seen.end(), tex.get()) != seen.end())
+                continue;
+            seen.push_back(tex.get());
+            s.bytesResident += tex->sizeBytes();
+        }
+        s.liveTextures = static_cast<uint32_t>(seen.size());
+        return s;
+    }
+
+} // namespace Render
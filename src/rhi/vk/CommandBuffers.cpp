@@ -5,10 +5,11 @@
 #include "rhi/vk/SwapChain.h"
 #include "rhi/vk/ImageViews.h"
 #include "rhi/vk/DepthResources.h"
+#include "rhi/vk/GpuDrivenPass.h"
 
 #include "core/Logger.h"
+#include "core/Stopwatch.h"
 #include "rhi/vk/Common.h"
-#include <rhi/vk/vk_utils.h>
 
 #include "ui/ImGuiLayer.h"
 
@@ -58,7 +59,9 @@ namespace Vk
                                 const DepthResources &depth,
                                 const std::vector<Gfx::DrawItem> &items,
                                 VkDescriptorSet viewSet,
-                                VkDescriptorSet lightingSet)
+                                VkDescriptorSet lightingSet,
+                                VkBuffer clusterIndexBuffer,
+                                GpuDrivenPass *gpuDriven)
     {
         if (imageIndex >= sceneBuffers_.size())
         {
@@ -68,6 +71,9 @@ namespace Vk
 
         VkCommandBuffer cmd = sceneBuffers_[imageIndex];
         VkImage swapchainImage = swapchain.getImages()[imageIndex];
+        Core::Stopwatch recordTimer;
+        RecordStats stats{};
+        const bool gpuDrivenDraw = gpuDriven && gpuDriven->ready();
 
         // 1) Begin recording
         VkCommandBufferBeginInfo beginInfo{};
@@ -100,6 +106,11 @@ namespace Vk
                              0, nullptr,
                              1, &acquireBarrier);
 
+        // 2b) GPU-driven path: cull every scene object into this image's indirect buffer
+        //     (compute + barriers must stay outside dynamic rendering)
+        if (gpuDrivenDraw)
+            gpuDriven->recordCull(cmd, imageIndex);
+
         // 3) Setup clear values
         VkClearValue clears[2]{};
         // clears[0].color = {{0.02f, 0.02f, 0.04f, 1.0f}};
@@ -156,51 +167,83 @@ namespace Vk
         scissor.extent = extent;
         vkCmdSetScissor(cmd, 0, 1, &scissor);
 
-        // 7) Draw meshes
-        for (const Gfx::DrawItem &it : items)
+        // 7) GPU-driven: its own view set (scene object buffer), one indirect-count draw per batch
+        if (gpuDrivenDraw)
         {
-            if (!it.mesh || !it.material)
-                continue;
-
+            gpuDriven->recordDraws(cmd, imageIndex, pipeline.getPipelineLayout(), lightingSet, stats);
+        }
+        else
+        {
+            // 7) Per-pass sets: [0] view UBO + object buffer, [2] lighting (set 1 is bound per material below;
+            //    binding it alone keeps 0 and 2 because every set uses the same pipeline layout)
             if (lightingSet != VK_NULL_HANDLE)
             {
-                // Bind descriptor sets: [0] view UBO, [1] material, [2] lightning
-                VkDescriptorSet sets[3] = {viewSet, it.material->descriptorSet(), lightingSet};
-                vkCmdBindDescriptorSets(cmd,
-                                        VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                        pipeline.getPipelineLayout(),
-                                        /*firstSet*/ 0, /*setCount*/ 3, sets,
-                                        /*dynamicOffsetCount*/ 0, /*pDynamicOffsets*/ nullptr);
+                vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.getPipelineLayout(),
+                                        /*firstSet*/ 2, /*setCount*/ 1, &lightingSet, 0, nullptr);
+                ++stats.descriptorSetBinds;
             }
-            else
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.getPipelineLayout(),
+                                    /*firstSet*/ 0, /*setCount*/ 1, &viewSet, 0, nullptr);
+            ++stats.descriptorSetBinds;
+
+            // 8) Draw meshes: material set / geometry rebound only when they differ from the previous draw
+            //    (the list is sorted by material, then mesh, so these are runs)
+            VkDescriptorSet boundMaterial = VK_NULL_HANDLE;
+            VkBuffer boundVertices = VK_NULL_HANDLE;
+            VkBuffer boundIndices = VK_NULL_HANDLE;
+            for (const Gfx::DrawItem &it : items)
             {
-                VkDescriptorSet sets[2] = {viewSet, it.material->descriptorSet()};
-                vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                        pipeline.getPipelineLayout(),
-                                        /*firstSet=*/0, /*setCount=*/2, sets,
-                                        0, nullptr);
+                if (!it.mesh || !it.material)
+                    continue;
+                // Every cluster culled (or no buffer to draw them from): nothing to submit
+                if (it.clustered && (it.clusterIndexCount == 0 || clusterIndexBuffer == VK_NULL_HANDLE))
+                    continue;
+
+                const VkBuffer vertices = it.mesh->vertexBuffer();
+                const VkBuffer indices = it.clustered ? clusterIndexBuffer : it.mesh->indexBuffer();
+                if (vertices == VK_NULL_HANDLE || indices == VK_NULL_HANDLE)
+                    continue;
+
+                // Bind material: set 1
+                const VkDescriptorSet material = it.material->descriptorSet();
+                if (material != boundMaterial)
+                {
+                    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.getPipelineLayout(),
+                                            /*firstSet*/ 1, /*setCount*/ 1, &material, 0, nullptr);
+                    boundMaterial = material;
+                    ++stats.descriptorSetBinds;
+                }
+
+                // Bind geometry: arena page vertices + page indices (or the frame's meshlet indices)
+                if (vertices != boundVertices)
+                {
+                    const VkDeviceSize zero = 0;
+                    vkCmdBindVertexBuffers(cmd, 0, 1, &vertices, &zero);
+                    boundVertices = vertices;
+                    ++stats.vertexBufferBinds;
+                }
+                if (indices != boundIndices)
+                {
+                    vkCmdBindIndexBuffer(cmd, indices, 0, VK_INDEX_TYPE_UINT32);
+                    boundIndices = indices;
+                    ++stats.indexBufferBinds;
+                }
+
+                // Model/normal matrices: object buffer entries from firstInstance (gl_InstanceIndex).
+                // Streamed meshlet indices are mesh-local too: same vertexOffset as the mesh's own LODs
+                if (it.clustered)
+                    vkCmdDrawIndexed(cmd, it.clusterIndexCount, 1, it.clusterFirstIndex, it.mesh->baseVertex(), it.firstInstance);
+                else
+                    it.mesh->draw(cmd, it.lod, it.firstInstance, it.instanceCount);
+                ++stats.draws;
+                stats.instances += it.instanceCount;
             }
-
-            // Bind geometry
-            it.mesh->bind(cmd);
-
-            // Push constants: model matrix only (128 bytes)
-            PushPC pc{};
-            pc.model = it.mesh->getLocalTransform();
-            glm::mat3 m3 = glm::mat3(pc.model);
-            pc.normalMatrix = glm::mat4(glm::transpose(glm::inverse(m3)));
-
-            vkCmdPushConstants(cmd, pipeline.getPipelineLayout(),
-                               VK_SHADER_STAGE_VERTEX_BIT, 0,
-                               static_cast<uint32_t>(sizeof(PushPC)), &pc);
-
-            it.mesh->draw(cmd);
         }
 
-        // 8) End dynamic rendering
+        // 9) End dynamic rendering
         vkCmdEndRendering(cmd);
 
-        // 9) TRANSITION: COLOR_ATTACHMENT_OPTIMAL -> PRESENT_SRC_KHR (for pesentation)
+        // 10) TRANSITION: COLOR_ATTACHMENT_OPTIMAL -> PRESENT_SRC_KHR (for pesentation)
         VkImageMemoryBarrier presentBarrier{};
         presentBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
         presentBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
@@ -224,8 +267,11 @@ namespace Vk
                              0, nullptr,
                              1, &presentBarrier);
 
-        // 10) Finish recording
+        // 11) Finish recording
         VK_CHECK(vkEndCommandBuffer(cmd));
+
+        stats.cpuMs = recordTimer.elapsedMs();
+        recordStats_ = stats;
     }
 
     void CommandBuffers::recordImGuiForImage(uint32_t imageIndex,
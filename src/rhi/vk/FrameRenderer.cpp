@@ -1,7 +1,9 @@
 #include "rhi/vk/FrameRenderer.h"
 
 #include "rhi/vk/RendererContext.h"
+#include "rhi/vk/GpuDrivenPass.h"
 #include "rhi/vk/VulkanRenderer.h"
+#include "rhi/vk/gfx/StreamingIndexBuffer.h"
 
 #include "rhi/vk/Common.h" // VK_CHECK, etc.
 
@@ -66,6 +68,25 @@ namespace Vk
         // Reset the fence for the current frame before submitting new work to the queue.
         VK_CHECK(vkResetFences(device.getDevice(), 1, &inFlightFence));
 
+        // The image's previous submission has completed, so its command buffers (and anything
+        // else it read, like its streaming index slot) can be rewritten
+        if (ctx.prepareImage)
+            ctx.prepareImage(imageIndex);
+
+        if (ctx.frameDrawItems)
+        {
+            // The GPU-driven pass reads its own scene object buffer: nothing to copy per frame
+            GpuDrivenPass *gpuDriven = ctx.gpuDriven && ctx.gpuDriven->ready() ? ctx.gpuDriven : nullptr;
+            if (ctx.frameObjects && !gpuDriven)
+                ctx.updateObjects(imageIndex, *ctx.frameObjects);
+
+            const VkBuffer clusterIndexBuffer = ctx.clusterIndices ? ctx.clusterIndices->buffer(imageIndex) : VK_NULL_HANDLE;
+            commandBuffers.record(imageIndex, ctx.graphicsPipeline,
+                                  swapChain, ctx.imageViews, ctx.depth,
+                                  *ctx.frameDrawItems, ctx.viewSet(imageIndex), ctx.lightingSet,
+                                  clusterIndexBuffer, gpuDriven);
+        }
+
         commandBuffers.recordImGuiForImage(imageIndex,
                                            swapChain, ctx.imageViews, ctx.depth, *ctx.imguiLayer);
 
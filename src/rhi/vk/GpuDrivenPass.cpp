@@ -0,0 +1,536 @@
+#include "rhi/vk/GpuDrivenPass.h"
+
+#include "rhi/vk/CommandBuffers.h"
+#include "rhi/vk/Common.h"
+#include "rhi/vk/DebugUtils.h"
+#include "rhi/vk/UploadContext.h"
+#include "rhi/vk/gfx/DrawItem.h"
+
+#include "core/Logger.h"
+#include "core/Stopwatch.h"
+#include "core/math/MathUtils.h"
+#include "render/ObjectData.h"
+#include "render/ViewUniforms.h"
+#include "render/materials/Material.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+namespace Vk
+{
+    namespace
+    {
+        /// Mirror of CullObject in shaders/cull.comp (std430).
+        struct CullObject
+        {
+            glm::vec4 sphere; // world center + radius
+            uint32_t indexCount;
+            uint32_t firstIndex;
+            int32_t vertexOffset;
+            uint32_t batch;
+        };
+        static_assert(sizeof(CullObject) == 32, "CullObject must match cull.comp");
+
+        /// Mirror of CullPC in shaders/cull.comp.
+        struct CullPush
+        {
+            glm::vec4 planes[6];
+            uint32_t objectCount;
+        };
+        static_assert(offsetof(CullPush, objectCount) == 96, "CullPush must match cull.comp");
+        constexpr uint32_t kCullPushBytes = offsetof(CullPush, objectCount) + sizeof(uint32_t);
+
+        constexpr uint32_t kGroupSize = 64;           // local_size_x of cull.comp
+        constexpr uint32_t kMaxDrawsPerBatch = 65535; // minimum maxDrawIndirectCount with multiDrawIndirect
+        constexpr uint32_t kCommandStride = sizeof(VkDrawIndexedIndirectCommand);
+
+    } // namespace
+
+    void GpuDrivenPass::create(VmaAllocator allocator, VkDevice device, float timestampPeriodNs)
+    {
+        destroy();
+
+        allocator_ = allocator;
+        device_ = device;
+        timestampPeriodNs_ = timestampPeriodNs;
+
+        createPipeline();
+    }
+
+    void GpuDrivenPass::setImages(VkDescriptorSetLayout viewSetLayout, const std::vector<VkBuffer> &viewUbos)
+    {
+        if (!device_)
+            return;
+
+        // 1) Previous images' sets, outputs and timestamps (the scene buffers are kept)
+        destroyImages();
+
+        // 2) Per-image sets: cull (4 storage buffers) + view (UBO + scene object buffer)
+        const uint32_t imageCount = static_cast<uint32_t>(viewUbos.size());
+        if (imageCount == 0)
+            return;
+
+        const VkDescriptorPoolSize sizes[] = {
+            {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 5 * imageCount},
+            {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, imageCount}};
+
+        VkDescriptorPoolCreateInfo pi{VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+        pi.maxSets = 2 * imageCount;
+        pi.poolSizeCount = static_cast<uint32_t>(std::size(sizes));
+        pi.pPoolSizes = sizes;
+        VK_CHECK(vkCreateDescriptorPool(device_, &pi, nullptr, &pool_));
+
+        images_.resize(imageCount);
+        for (uint32_t i = 0; i < imageCount; ++i)
+        {
+            const VkDescriptorSetLayout layouts[2] = {cullSetLayout_, viewSetLayout};
+            VkDescriptorSet sets[2]{};
+
+            VkDescriptorSetAllocateInfo ai{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+            ai.descriptorPool = pool_;
+            ai.descriptorSetCount = 2;
+            ai.pSetLayouts = layouts;
+            VK_CHECK(vkAllocateDescriptorSets(device_, &ai, sets));
+
+            images_[i].cullSet = sets[0];
+            images_[i].viewSet = sets[1];
+            images_[i].viewUbo = viewUbos[i];
+        }
+
+        // 3) Two timestamps per image around the cull dispatch
+        if (timestampPeriodNs_ > 0.0f)
+        {
+            VkQueryPoolCreateInfo qi{VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO};
+            qi.queryType = VK_QUERY_TYPE_TIMESTAMP;
+            qi.queryCount = 2 * imageCount;
+            VK_CHECK(vkCreateQueryPool(device_, &qi, nullptr, &timestamps_));
+        }
+
+        // 4) Outputs for the current scene (if one is set)
+        createOutputs();
+        writeSets();
+    }
+
+    void GpuDrivenPass::createPipeline()
+    {
+        // 1) Set layout: objects, batchFirst, commands, counts
+        VkDescriptorSetLayoutBinding bindings[4]{};
+        for (uint32_t b = 0; b < 4; ++b)
+        {
+            bindings[b].binding = b;
+            bindings[b].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[b].descriptorCount = 1;
+            bindings[b].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+
+        VkDescriptorSetLayoutCreateInfo li{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+        li.bindingCount = 4;
+        li.pBindings = bindings;
+        VK_CHECK(vkCreateDescriptorSetLayout(device_, &li, nullptr, &cullSetLayout_));
+
+        // 2) Pipeline layout: the set + frustum planes / object count
+        VkPushConstantRange pc{};
+        pc.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pc.offset = 0;
+        pc.size = kCullPushBytes;
+
+        VkPipelineLayoutCreateInfo pli{VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+        pli.setLayoutCount = 1;
+        pli.pSetLayouts = &cullSetLayout_;
+        pli.pushConstantRangeCount = 1;
+        pli.pPushConstantRanges = &pc;
+        VK_CHECK(vkCreatePipelineLayout(device_, &pli, nullptr, &pipelineLayout_));
+
+        // 3) Compute pipeline
+        const std::vector<char> code = readBinaryFile("shaders/cull.spv");
+
+        VkShaderModuleCreateInfo mi{VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+        mi.codeSize = code.size();
+        mi.pCode = reinterpret_cast<const uint32_t *>(code.data());
+
+        VkShaderModule module = VK_NULL_HANDLE;
+        VK_CHECK(vkCreateShaderModule(device_, &mi, nullptr, &module));
+
+        VkComputePipelineCreateInfo ci{VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+        ci.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        ci.stage.module = module;
+        ci.stage.pName = "main";
+        ci.layout = pipelineLayout_;
+
+        const VkResult res = vkCreateComputePipelines(device_, VK_NULL_HANDLE, 1, &ci, nullptr, &pipeline_);
+        vkDestroyShaderModule(device_, module, nullptr);
+        VK_CHECK(res);
+
+        namePipeline(device_, pipeline_, "GpuDriven.Cull");
+    }
+
+    void GpuDrivenPass::destroyImages() noexcept
+    {
+        images_.clear();
+        if (device_)
+        {
+            if (timestamps_)
+                vkDestroyQueryPool(device_, timestamps_, nullptr);
+            if (pool_)
+                vkDestroyDescriptorPool(device_, pool_, nullptr); // frees the sets
+        }
+        timestamps_ = VK_NULL_HANDLE;
+        pool_ = VK_NULL_HANDLE;
+    }
+
+    void GpuDrivenPass::destroy() noexcept
+    {
+        destroyImages();
+        cullObjects_.destroy();
+        sceneObjects_.destroy();
+        batchFirst_.destroy();
+        batches_.clear();
+        objectCount_ = 0;
+        sceneGeneration_ = 0;
+        stats_ = {};
+
+        if (device_)
+        {
+            if (pipeline_)
+                vkDestroyPipeline(device_, pipeline_, nullptr);
+            if (pipelineLayout_)
+                vkDestroyPipelineLayout(device_, pipelineLayout_, nullptr);
+            if (cullSetLayout_)
+                vkDestroyDescriptorSetLayout(device_, cullSetLayout_, nullptr);
+        }
+        pipeline_ = VK_NULL_HANDLE;
+        pipelineLayout_ = VK_NULL_HANDLE;
+        cullSetLayout_ = VK_NULL_HANDLE;
+        device_ = VK_NULL_HANDLE;
+        allocator_ = VK_NULL_HANDLE;
+    }
+
+    void GpuDrivenPass::setScene(UploadContext &upload, const std::vector<Gfx::DrawItem> &sceneItems,
+                                 const std::vector<Render::ObjectData> &sceneObjects, uint64_t sceneGeneration)
+    {
+        if (!device_)
+            return;
+        if (sceneObjects.size() != sceneItems.size())
+            throw std::runtime_error("GpuDrivenPass::setScene(): object data doesn't match the scene items");
+
+        Core::Stopwatch sw;
+        using BatchKey = std::tuple<const Render::Material *, VkBuffer, VkBuffer>;
+
+        auto drawable = [](const Gfx::DrawItem &it)
+        {
+            return it.mesh && it.material && it.mesh->lodCount() > 0 &&
+                   it.mesh->vertexBuffer() != VK_NULL_HANDLE && it.mesh->indexBuffer() != VK_NULL_HANDLE;
+        };
+        auto keyOf = [](const Gfx::DrawItem &it)
+        { return BatchKey{it.material, it.mesh->vertexBuffer(), it.mesh->indexBuffer()}; };
+
+        // 1) Distinct keys (material + geometry page), sorted; scenes hold few of them and list
+        //    instances of one key together, so most objects only compare against the previous key
+        std::vector<BatchKey> keys;
+        for (const Gfx::DrawItem &it : sceneItems)
+        {
+            if (!drawable(it))
+                continue;
+            const BatchKey key = keyOf(it);
+            if (!keys.empty() && keys.back() == key)
+                continue;
+            const auto pos = std::lower_bound(keys.begin(), keys.end(), key);
+            if (pos == keys.end() || *pos != key)
+                keys.insert(pos, key);
+        }
+
+        // 2) Key of every object (index into keys) and objects per key
+        std::vector<uint32_t> objectKeys;
+        objectKeys.reserve(sceneItems.size());
+        std::vector<uint32_t> objectsPerKey(keys.size(), 0);
+        uint32_t lastKey = 0;
+        for (const Gfx::DrawItem &it : sceneItems)
+        {
+            if (!drawable(it))
+                continue;
+            const BatchKey key = keyOf(it);
+            if (keys[lastKey] != key)
+                lastKey = static_cast<uint32_t>(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+            objectKeys.push_back(lastKey);
+            ++objectsPerKey[lastKey];
+        }
+
+        // 3) Batches in key order (split at kMaxDrawsPerBatch) so consecutive batches share the material set
+        batches_.clear();
+        std::vector<uint32_t> firstBatch(keys.size());
+        for (std::size_t k = 0; k < keys.size(); ++k)
+        {
+            firstBatch[k] = static_cast<uint32_t>(batches_.size());
+            for (uint32_t done = 0; done < objectsPerKey[k]; done += kMaxDrawsPerBatch)
+                batches_.push_back(Batch{std::get<0>(keys[k]), std::get<1>(keys[k]), std::get<2>(keys[k]),
+                                         0, std::min(kMaxDrawsPerBatch, objectsPerKey[k] - done)});
+        }
+
+        std::vector<uint32_t> batchFirst(batches_.size());
+        uint32_t slots = 0;
+        for (std::size_t b = 0; b < batches_.size(); ++b)
+        {
+            batches_[b].first = slots;
+            batchFirst[b] = slots;
+            slots += batches_[b].capacity;
+        }
+
+        // 4) Objects: cull data + transforms (object index = firstInstance of its draw)
+        std::vector<CullObject> cullObjects;
+        std::vector<Render::ObjectData> objects;
+        cullObjects.reserve(slots);
+        objects.reserve(slots);
+
+        std::vector<uint32_t> placed(keys.size(), 0);
+        std::size_t object = 0;
+        for (std::size_t i = 0; i < sceneItems.size(); ++i)
+        {
+            const Gfx::DrawItem &it = sceneItems[i];
+            if (!drawable(it))
+                continue;
+
+            const uint32_t key = objectKeys[object++];
+            const uint32_t batch = firstBatch[key] + placed[key]++ / kMaxDrawsPerBatch;
+
+            const Core::MathUtils::AABB box =
+                Core::MathUtils::transformAABB({it.mesh->getMin(), it.mesh->getMax()}, it.transform);
+            const glm::vec3 center = 0.5f * (box.min + box.max);
+            const float radius = 0.5f * glm::length(box.max - box.min);
+
+            const Gfx::Mesh::Lod &lod0 = it.mesh->lod(0);
+            cullObjects.push_back(CullObject{glm::vec4(center, radius), lod0.indexCount,
+                                             it.mesh->firstIndex() + lod0.firstIndex, it.mesh->baseVertex(), batch});
+            objects.push_back(sceneObjects[i]);
+        }
+        objectCount_ = static_cast<uint32_t>(cullObjects.size());
+
+        // 5) Static buffers: written once, read by every frame from device-local memory
+        //    (a direct write on UMA / ReBAR, a staged copy otherwise; like GeometryArena pages)
+        auto fill = [&](Gfx::Buffer &buffer, const void *data, VkDeviceSize bytes, const char *name)
+        {
+            buffer.destroy();
+            buffer.createDeviceLocal(allocator_, device_, std::max<VkDeviceSize>(bytes, 16),
+                                     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, name);
+            upload.writeBuffer(buffer, data, bytes);
+        };
+        fill(cullObjects_, cullObjects.data(), cullObjects.size() * sizeof(CullObject), "GpuDriven.CullObjects");
+        fill(sceneObjects_, objects.data(), objects.size() * sizeof(Render::ObjectData), "GpuDriven.Objects");
+        fill(batchFirst_, batchFirst.data(), batchFirst.size() * sizeof(uint32_t), "GpuDriven.BatchFirst");
+        upload.flush();
+
+        // 6) Per-image outputs sized for this scene
+        createOutputs();
+        writeSets();
+
+        sceneGeneration_ = sceneGeneration;
+        stats_.objects = objectCount_;
+        stats_.batches = static_cast<uint32_t>(batches_.size());
+        stats_.setSceneMs = sw.elapsedMs();
+        CORE_LOG_INFO("GpuDrivenPass: " + std::to_string(objectCount_) + " objects in " +
+                      std::to_string(batches_.size()) + " batches (" + std::to_string(stats_.setSceneMs) + " ms)");
+    }
+
+    void GpuDrivenPass::createOutputs()
+    {
+        if (!cullObjects_.get())
+            return;
+
+        // One command slot per object, one counter per batch
+        for (PerImage &img : images_)
+        {
+            img.commands.destroy();
+            img.commands.create(allocator_, device_, VkDeviceSize(std::max(objectCount_, 1u)) * kCommandStride,
+                                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+                                VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, 0, "GpuDriven.Commands");
+            img.counts.destroy();
+            img.counts.create(allocator_, device_, VkDeviceSize(std::max<std::size_t>(batches_.size(), 1)) * sizeof(uint32_t),
+                              VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+                                  VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                              VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, 0, "GpuDriven.Counts");
+            img.timed = false;
+        }
+    }
+
+    void GpuDrivenPass::writeSets()
+    {
+        if (!cullObjects_.get())
+            return;
+
+        for (PerImage &img : images_)
+        {
+            const VkDescriptorBufferInfo cullInfos[4] = {
+                {cullObjects_.get(), 0, VK_WHOLE_SIZE},
+                {batchFirst_.get(), 0, VK_WHOLE_SIZE},
+                {img.commands.get(), 0, VK_WHOLE_SIZE},
+                {img.counts.get(), 0, VK_WHOLE_SIZE}};
+            const VkDescriptorBufferInfo viewInfos[2] = {
+                {img.viewUbo, 0, sizeof(Render::ViewUniforms)},
+                {sceneObjects_.get(), 0, VK_WHOLE_SIZE}};
+
+            VkWriteDescriptorSet writes[3]{};
+            writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[0].dstSet = img.cullSet;
+            writes[0].dstBinding = 0;
+            writes[0].descriptorCount = 4;
+            writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writes[0].pBufferInfo = cullInfos;
+
+            writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[1].dstSet = img.viewSet;
+            writes[1].dstBinding = 0;
+            writes[1].descriptorCount = 1;
+            writes[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            writes[1].pBufferInfo = &viewInfos[0];
+
+            writes[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[2].dstSet = img.viewSet;
+            writes[2].dstBinding = 1;
+            writes[2].descriptorCount = 1;
+            writes[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writes[2].pBufferInfo = &viewInfos[1];
+
+            vkUpdateDescriptorSets(device_, 3, writes, 0, nullptr);
+        }
+    }
+
+    void GpuDrivenPass::prepare(uint32_t imageIndex, const glm::mat4 &viewProj)
+    {
+        if (imageIndex >= images_.size())
+            return;
+        PerImage &img = images_[imageIndex];
+
+        // 1) Cull time of the image's previous frame (its submission has completed)
+        if (timestamps_ && img.timed)
+        {
+            uint64_t ticks[2]{};
+            if (vkGetQueryPoolResults(device_, timestamps_, 2 * imageIndex, 2, sizeof(ticks), ticks,
+                                      sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) == VK_SUCCESS)
+                stats_.cullGpuMs = double(ticks[1] - ticks[0]) * timestampPeriodNs_ * 1e-6;
+        }
+
+        // 2) Frustum for this image's dispatch
+        const Core::MathUtils::Frustum f = Core::MathUtils::extractFrustum(viewProj);
+        for (int p = 0; p < 6; ++p)
+            img.planes[p] = f.planes[p];
+    }
+
+    void GpuDrivenPass::recordCull(VkCommandBuffer cmd, uint32_t imageIndex)
+    {
+        if (!ready() || imageIndex >= images_.size())
+            return;
+        PerImage &img = images_[imageIndex];
+
+        if (timestamps_)
+        {
+            vkCmdResetQueryPool(cmd, timestamps_, 2 * imageIndex, 2);
+            vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamps_, 2 * imageIndex);
+        }
+
+        // 1) Zero the per-batch counters; the shader's atomics must see it
+        vkCmdFillBuffer(cmd, img.counts.get(), 0, VK_WHOLE_SIZE, 0);
+
+        VkMemoryBarrier toCompute{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+        toCompute.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        toCompute.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(cmd,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0,
+                             1, &toCompute,
+                             0, nullptr,
+                             0, nullptr);
+
+        // 2) Cull: one invocation per object, survivors appended to their batch's slots
+        CullPush push{};
+        for (int p = 0; p < 6; ++p)
+            push.planes[p] = img.planes[p];
+        push.objectCount = objectCount_;
+
+        vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_);
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout_,
+                                0, 1, &img.cullSet, 0, nullptr);
+        vkCmdPushConstants(cmd, pipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT, 0, kCullPushBytes, &push);
+        vkCmdDispatch(cmd, (objectCount_ + kGroupSize - 1) / kGroupSize, 1, 1);
+
+        // 3) Commands + counts -> indirect draw arguments
+        VkMemoryBarrier toIndirect{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+        toIndirect.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        toIndirect.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+        vkCmdPipelineBarrier(cmd,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                             0,
+                             1, &toIndirect,
+                             0, nullptr,
+                             0, nullptr);
+
+        if (timestamps_)
+        {
+            vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, timestamps_, 2 * imageIndex + 1);
+            img.timed = true;
+        }
+    }
+
+    void GpuDrivenPass::recordDraws(VkCommandBuffer cmd, uint32_t imageIndex, VkPipelineLayout layout,
+                                    VkDescriptorSet lightingSet, RecordStats &stats) const
+    {
+        if (!ready() || imageIndex >= images_.size())
+            return;
+        const PerImage &img = images_[imageIndex];
+
+        // 1) Per-pass sets: [0] view UBO + scene object buffer, [2] lighting
+        if (lightingSet != VK_NULL_HANDLE)
+        {
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, layout,
+                                    /*firstSet*/ 2, /*setCount*/ 1, &lightingSet, 0, nullptr);
+            ++stats.descriptorSetBinds;
+        }
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, layout,
+                                /*firstSet*/ 0, /*setCount*/ 1, &img.viewSet, 0, nullptr);
+        ++stats.descriptorSetBinds;
+
+        // 2) One indirect-count draw per batch; the GPU decides how many of its slots are used
+        VkDescriptorSet boundMaterial = VK_NULL_HANDLE;
+        VkBuffer boundVertices = VK_NULL_HANDLE;
+        VkBuffer boundIndices = VK_NULL_HANDLE;
+        for (std::size_t b = 0; b < batches_.size(); ++b)
+        {
+            const Batch &batch = batches_[b];
+
+            const VkDescriptorSet material = batch.material->descriptorSet();
+            if (material != boundMaterial)
+            {
+                vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, layout,
+                                        /*firstSet*/ 1, /*setCount*/ 1, &material, 0, nullptr);
+                boundMaterial = material;
+                ++stats.descriptorSetBinds;
+            }
+            if (batch.vertices != boundVertices)
+            {
+                const VkDeviceSize zero = 0;
+                vkCmdBindVertexBuffers(cmd, 0, 1, &batch.vertices, &zero);
+                boundVertices = batch.vertices;
+                ++stats.vertexBufferBinds;
+            }
+            if (batch.indices != boundIndices)
+            {
+                vkCmdBindIndexBuffer(cmd, batch.indices, 0, VK_INDEX_TYPE_UINT32);
+                boundIndices = batch.indices;
+                ++stats.indexBufferBinds;
+            }
+
+            vkCmdDrawIndexedIndirectCount(cmd,
+                                          img.commands.get(), VkDeviceSize(batch.first) * kCommandStride,
+                                          img.counts.get(), VkDeviceSize(b) * sizeof(uint32_t),
+                                          batch.capacity, kCommandStride);
+            ++stats.indirectDraws;
+        }
+    }
+
+} // namespace Vk
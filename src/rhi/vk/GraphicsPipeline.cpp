@@ -6,9 +6,7 @@
 #include "rhi/vk/Common.h"
 
 #include "rhi/vk/gfx/Vertex.h"
-#include <rhi/vk/vk_utils.h>
 
-#include <fstream>
 #include <stdexcept>
 #include <array>
 #include <glm/mat4x4.hpp> // for sizeof(glm::mat4)
@@ -22,8 +20,8 @@ namespace Vk
         : device(device_)
     {
         // --- 1) Load SPIR-V ---
-        auto vertShaderCode = readFile("shaders/vert.spv");
-        auto fragShaderCode = readFile("shaders/frag.spv");
+        auto vertShaderCode = readBinaryFile("shaders/vert.spv");
+        auto fragShaderCode = readBinaryFile("shaders/frag.spv");
 
         VkShaderModule vertShaderModule = createShaderModule(vertShaderCode);
         VkShaderModule fragShaderModule = createShaderModule(fragShaderCode);
@@ -95,16 +93,21 @@ namespace Vk
         colorBlending.pAttachments = &colorBlendAttachment;
 
         // --- 10) Descriptor set layouts ---
-        // set = 0 (View UBO for VS)
-        VkDescriptorSetLayoutBinding viewBinding{};
-        viewBinding.binding = 0;
-        viewBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        viewBinding.descriptorCount = 1;
-        viewBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+        // set = 0 (View UBO for VS/FS + per-draw object buffer for VS)
+        std::array<VkDescriptorSetLayoutBinding, 2> viewBindings{};
+        viewBindings[0].binding = 0;
+        viewBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        viewBindings[0].descriptorCount = 1;
+        viewBindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+
+        viewBindings[1].binding = 1;
+        viewBindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        viewBindings[1].descriptorCount = 1;
+        viewBindings[1].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
 
         VkDescriptorSetLayoutCreateInfo viewDslCi{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
-        viewDslCi.bindingCount = 1;
-        viewDslCi.pBindings = &viewBinding;
+        viewDslCi.bindingCount = static_cast<uint32_t>(viewBindings.size());
+        viewDslCi.pBindings = viewBindings.data();
         VK_CHECK(vkCreateDescriptorSetLayout(device.getDevice(), &viewDslCi, nullptr, &viewSetLayout));
 
         // set = 1 (Material: 5 textures + 1 UBO for FS)
@@ -172,19 +175,13 @@ namespace Vk
         lightDslCi.pBindings = lightBindings.data();
         VK_CHECK(vkCreateDescriptorSetLayout(device.getDevice(), &lightDslCi, nullptr, &lightingSetLayout));
 
-        // --- 11) Push constants: mat4 model (VS) ---
-        VkPushConstantRange pcRange{};
-        pcRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-        pcRange.offset = 0;
-        pcRange.size = static_cast<uint32_t>(sizeof(PushPC));
+        // --- 11) No push constants: per-draw data comes from the object buffer (set 0, binding 1) ---
 
-        // --- 12) Pipeline layout with two set layouts ---
+        // --- 12) Pipeline layout with three set layouts ---
         const VkDescriptorSetLayout setLayouts[] = {viewSetLayout, materialSetLayout, lightingSetLayout};
         VkPipelineLayoutCreateInfo pipelineLayoutInfo{VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
         pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(std::size(setLayouts));
         pipelineLayoutInfo.pSetLayouts = setLayouts;
-        pipelineLayoutInfo.pushConstantRangeCount = 1;
-        pipelineLayoutInfo.pPushConstantRanges = &pcRange;
 
         VK_CHECK(vkCreatePipelineLayout(device.getDevice(), &pipelineLayoutInfo, nullptr, &pipelineLayout));
 
@@ -268,17 +265,4 @@ namespace Vk
         return m;
     }
 
-    std::vector<char> GraphicsPipeline::readFile(const std::string &filename) const
-    {
-        std::ifstream file(filename, std::ios::ate | std::ios::binary);
-        if (!file.is_open())
-            throw std::runtime_error("Failed to open file " + filename);
-
-        const size_t fileSize = static_cast<size_t>(file.tellg());
-        std::vector<char> buffer(fileSize);
-        file.seekg(0);
-        file.read(buffer.data(), fileSize);
-        return buffer;
-    }
-
 } // namespace Vk
\ No newline at end of file
@@ -17,14 +17,16 @@ namespace Vk
     {
         destroyViewResources(); // safe no-op if empty
 
-        // Create descriptor pool for view sets (small)
-        VkDescriptorPoolSize poolSize{};
-        poolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        poolSize.descriptorCount = static_cast<uint32_t>(swapChain.getImages().size());
+        // Create descriptor pool for view sets (small): view UBO + object buffer each
+        VkDescriptorPoolSize poolSizes[2]{};
+        poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        poolSizes[0].descriptorCount = static_cast<uint32_t>(swapChain.getImages().size());
+        poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        poolSizes[1].descriptorCount = static_cast<uint32_t>(swapChain.getImages().size());
 
         VkDescriptorPoolCreateInfo poolCi{VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
-        poolCi.poolSizeCount = 1;
-        poolCi.pPoolSizes = &poolSize;
+        poolCi.poolSizeCount = 2;
+        poolCi.pPoolSizes = poolSizes;
         poolCi.maxSets = static_cast<uint32_t>(swapChain.getImages().size());
 
         VK_CHECK(vkCreateDescriptorPool(device.getDevice(), &poolCi, nullptr, &viewDescPool));
@@ -53,6 +55,14 @@ namespace Vk
         frameResources[imageIndex].updateViewUbo(device.getDevice(), uboData);
     }
 
+    void RendererContext::updateObjects(uint32_t imageIndex, const std::vector<Render::ObjectData> &objects) const
+    {
+        if (imageIndex >= frameResources.size())
+            return;
+        frameResources[imageIndex].updateObjects(physDevice.getDevice(), device.getDevice(),
+                                                 objects.data(), objects.size());
+    }
+
     void RendererContext::destroyViewResources() noexcept
     {
         if (!device.getDevice())
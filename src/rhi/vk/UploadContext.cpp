@@ -0,0 +1,538 @@
+#include "rhi/vk/UploadContext.h"
+#include "rhi/vk/Common.h"
+#include "core/Stopwatch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <string>
+
+namespace Vk
+{
+    namespace
+    {
+        uint64_t alignUp(uint64_t v, uint64_t a) { return (v + a - 1) / a * a; }
+    } // namespace
+
+    UploadContext::UploadContext(VmaAllocator allocator,
+                                 VkDevice device,
+                                 uint32_t transferFamily,
+                                 VkQueue transferQueue,
+                                 uint32_t graphicsFamily,
+                                 VkQueue graphicsQueue,
+                                 VkDeviceSize ringBytes,
+                                 VkExtent3D imageGranularity)
+        : allocator_(allocator), device_(device),
+          transferQueue_(transferQueue), graphicsQueue_(graphicsQueue),
+          transferFamily_(transferFamily), graphicsFamily_(graphicsFamily),
+          bandRowMultiple_(imageGranularity.height)
+    {
+        if (ringBytes < 1024)
+            throw std::runtime_error("UploadContext: staging ring too small");
+        if (imageGranularity.width == 0 || imageGranularity.height == 0 || imageGranularity.depth == 0)
+            throw std::runtime_error("UploadContext: transfer family only allows whole-mip image copies");
+
+        // 1) Transient pools: batches are short-lived; RESET so recycled CBs can be re-begun individually.
+        VkCommandPoolCreateInfo ci{VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+        ci.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        ci.queueFamilyIndex = transferFamily_;
+        VK_CHECK(vkCreateCommandPool(device_, &ci, nullptr, &pool_));
+        if (crossFamily())
+        {
+            ci.queueFamilyIndex = graphicsFamily_;
+            VK_CHECK(vkCreateCommandPool(device_, &ci, nullptr, &gfxPool_));
+        }
+
+        // 2) Persistently mapped staging ring shared by every upload
+        ringSize_ = ringBytes;
+        ring_.create(allocator_, device_, ringSize_,
+                     VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                     VMA_MEMORY_USAGE_AUTO,
+                     VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                         VMA_ALLOCATION_CREATE_MAPPED_BIT,
+                     "Upload Staging Ring");
+        ringMapped_ = static_cast<std::byte *>(ring_.map());
+    }
+
+    UploadContext::~UploadContext() noexcept
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+            // Device lost etc.: nothing sensible left to do in a destructor.
+        }
+
+        auto release = [&](Batch &b)
+        {
+            if (b.fence)
+                vkDestroyFence(device_, b.fence, nullptr);
+            if (b.copiesDone)
+                vkDestroySemaphore(device_, b.copiesDone, nullptr);
+        };
+        if (recording_)
+            release(current_);
+        for (Batch &b : inFlight_)
+            release(b);
+        for (Batch &b : free_)
+            release(b);
+
+        // Destroying a pool frees every command buffer allocated from it
+        if (pool_)
+            vkDestroyCommandPool(device_, pool_, nullptr);
+        if (gfxPool_)
+            vkDestroyCommandPool(device_, gfxPool_, nullptr);
+        ring_.destroy();
+    }
+
+    void UploadContext::open()
+    {
+        // 1) Reuse a completed batch if possible, otherwise allocate new CBs + fence (+ semaphore)
+        if (!free_.empty())
+        {
+            current_ = free_.back();
+            free_.pop_back();
+            VK_CHECK(vkResetCommandBuffer(current_.cmd, 0));
+            if (current_.gfxCmd)
+                VK_CHECK(vkResetCommandBuffer(current_.gfxCmd, 0));
+        }
+        else
+        {
+            current_ = Batch{};
+
+            VkCommandBufferAllocateInfo ai{VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+            ai.commandPool = pool_;
+            ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            ai.commandBufferCount = 1;
+            VK_CHECK(vkAllocateCommandBuffers(device_, &ai, &current_.cmd));
+            ++stats_.commandBuffers;
+
+            if (crossFamily())
+            {
+                ai.commandPool = gfxPool_;
+                VK_CHECK(vkAllocateCommandBuffers(device_, &ai, &current_.gfxCmd));
+                ++stats_.commandBuffers;
+
+                VkSemaphoreCreateInfo si{VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO};
+                VK_CHECK(vkCreateSemaphore(device_, &si, nullptr, &current_.copiesDone));
+            }
+
+            VkFenceCreateInfo fi{VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+            VK_CHECK(vkCreateFence(device_, &fi, nullptr, &current_.fence));
+        }
+
+        // 2) Begin recording
+        VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+        bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        VK_CHECK(vkBeginCommandBuffer(current_.cmd, &bi));
+        if (current_.gfxCmd)
+            VK_CHECK(vkBeginCommandBuffer(current_.gfxCmd, &bi));
+
+        current_.ringBegin = ringHead_;
+        current_.ringEnd = ringHead_;
+        recording_ = true;
+    }
+
+    VkCommandBuffer UploadContext::commands()
+    {
+        if (!recording_)
+            open();
+        return current_.cmd;
+    }
+
+    VkCommandBuffer UploadContext::graphicsCommands()
+    {
+        if (!recording_)
+            open();
+        return current_.gfxCmd ? current_.gfxCmd : current_.cmd;
+    }
+
+    void UploadContext::transferOwnership(VkImage image, VkImageLayout layout, uint32_t mipLevels)
+    {
+        if (!crossFamily())
+            return;
+
+        VkImageMemoryBarrier barrier{VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+        barrier.image = image;
+        barrier.oldLayout = layout;
+        barrier.newLayout = layout;
+        barrier.srcQueueFamilyIndex = transferFamily_;
+        barrier.dstQueueFamilyIndex = graphicsFamily_;
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, mipLevels, 0, 1};
+
+        // 1) Release: make the copies available; dst access is ignored on the releasing queue
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = 0;
+        vkCmdPipelineBarrier(commands(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        // 2) Acquire: ordered after the release by the batch semaphore; the graphics side continues with transfers (blits)
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(graphicsCommands(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+
+    void UploadContext::transferOwnership(VkBuffer dst, VkDeviceSize offset, VkDeviceSize size)
+    {
+        if (!crossFamily())
+            return;
+
+        VkBufferMemoryBarrier barrier{VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER};
+        barrier.buffer = dst;
+        barrier.offset = offset;
+        barrier.size = size;
+        barrier.srcQueueFamilyIndex = transferFamily_;
+        barrier.dstQueueFamilyIndex = graphicsFamily_;
+
+        // Same release/acquire pair as for images
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = 0;
+        vkCmdPipelineBarrier(commands(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                             0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                                VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(graphicsCommands(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                             0, 0, nullptr, 1, &barrier, 0, nullptr);
+    }
+
+    VkDeviceSize UploadContext::acquire(VkDeviceSize bytes, VkDeviceSize alignment)
+    {
+        // 1) Cap a batch at half the ring so the GPU drains one half while the CPU fills the other
+        if (recording_ && (current_.ringEnd - current_.ringBegin) + bytes > ringSize_ / 2)
+            submit();
+
+        for (;;)
+        {
+            // 2) Aligned start; skip the tail end of the ring rather than straddle it
+            uint64_t start = alignUp(ringHead_, alignment);
+            const uint64_t offset = start % ringSize_;
+            if (offset + bytes > ringSize_)
+                start += ringSize_ - offset;
+
+            if (start + bytes - ringTail_ <= ringSize_)
+            {
+                if (!recording_)
+                    open();
+                ringHead_ = start + bytes;
+                current_.ringEnd = ringHead_;
+                stats_.ringPeakBytes = std::max<uint64_t>(stats_.ringPeakBytes, ringHead_ - ringTail_);
+                return VkDeviceSize(start % ringSize_);
+            }
+
+            // 3) Wrapped onto data the GPU may still read: recycle the oldest batch
+            if (recording_ && current_.ringEnd != current_.ringBegin)
+                submit();
+            if (inFlight_.empty())
+                throw std::logic_error("UploadContext: staging ring exhausted with nothing in flight");
+            ++stats_.ringStalls;
+            waitUntil(inFlight_.front().ticket);
+        }
+    }
+
+    void UploadContext::write(VkDeviceSize offset, const void *data, VkDeviceSize bytes)
+    {
+        std::memcpy(ringMapped_ + offset, data, static_cast<size_t>(bytes));
+        // No-op on HOST_COHERENT memory
+        VK_CHECK(vmaFlushAllocation(allocator_, ring_.allocation(), offset, bytes));
+        stats_.stagedBytes += bytes;
+    }
+
+    void UploadContext::copyToBuffer(const void *data, VkDeviceSize bytes,
+                                     VkBuffer dst, VkDeviceSize dstOffset)
+    {
+        if (!data || bytes == 0)
+            return;
+
+        Core::Stopwatch sw;
+        const VkDeviceSize maxChunk = ringSize_ / 2 / 16 * 16;
+        const auto *src = static_cast<const std::byte *>(data);
+
+        // Oversized uploads become several ring-sized copies into the same destination
+        for (VkDeviceSize done = 0; done < bytes;)
+        {
+            const VkDeviceSize chunk = std::min(bytes - done, maxChunk);
+            const VkDeviceSize offset = acquire(chunk, 16);
+            write(offset, src + done, chunk);
+
+            VkBufferCopy region{};
+            region.srcOffset = offset;
+            region.dstOffset = dstOffset + done;
+            region.size = chunk;
+            vkCmdCopyBuffer(commands(), ring_.get(), dst, 1, &region);
+            ++stats_.copies;
+
+            // Per chunk: the next chunk may land in another batch
+            transferOwnership(dst, region.dstOffset, chunk);
+
+            done += chunk;
+        }
+        stats_.activeMs += sw.elapsedMs();
+    }
+
+    void UploadContext::writeBuffer(Gfx::Buffer &dst, const void *data, VkDeviceSize bytes, VkDeviceSize dstOffset)
+    {
+        if (!data || bytes == 0)
+            return;
+        if (dstOffset + bytes > dst.size())
+            throw std::runtime_error("UploadContext::writeBuffer(): write exceeds buffer size");
+
+        if (!dst.hostVisible())
+        {
+            copyToBuffer(data, bytes, dst.get(), dstOffset);
+            return;
+        }
+
+        // UMA / ReBAR: the destination itself is mapped; the next queue submit makes host writes visible
+        Core::Stopwatch sw;
+        std::memcpy(static_cast<std::byte *>(dst.map()) + dstOffset, data, static_cast<size_t>(bytes));
+        VK_CHECK(vmaFlushAllocation(dst.allocator(), dst.allocation(), dstOffset, bytes));
+        ++stats_.directWrites;
+        stats_.directBytes += bytes;
+        stats_.directMs += sw.elapsedMs();
+    }
+
+    void UploadContext::copyToImage(const void *pixels, uint32_t width, uint32_t height,
+                                    uint32_t bytesPerPixel, VkImage dst)
+    {
+        if (!pixels || width == 0 || height == 0 || bytesPerPixel == 0)
+            return;
+
+        Core::Stopwatch sw;
+        const VkDeviceSize rowBytes = VkDeviceSize(width) * bytesPerPixel;
+        const VkDeviceSize maxChunk = ringSize_ / 2;
+        if (rowBytes > maxChunk)
+            throw std::runtime_error("UploadContext::copyToImage(): one row exceeds half the staging ring");
+
+        // bufferOffset must be a multiple of the texel size and of 4
+        const VkDeviceSize alignment = std::lcm(VkDeviceSize(bytesPerPixel), VkDeviceSize(16));
+        // Whole-row bands keep each copy a plain rectangle; every band but the last (which ends on the
+        // image edge) must be a multiple of the queue's image granularity
+        const uint32_t rowsPerChunk = bandRows(height, maxChunk / rowBytes);
+        if (rowsPerChunk == 0)
+            throw std::runtime_error("UploadContext::copyToImage(): one granularity band exceeds half the staging ring");
+        const auto *src = static_cast<const std::byte *>(pixels);
+
+        for (uint32_t y = 0; y < height; y += rowsPerChunk)
+        {
+            const uint32_t rows = std::min(rowsPerChunk, height - y);
+            const VkDeviceSize bytes = rowBytes * rows;
+            const VkDeviceSize offset = acquire(bytes, alignment);
+            write(offset, src + rowBytes * y, bytes);
+
+            VkBufferImageCopy region{};
+            region.bufferOffset = offset;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = 0;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset = {0, int32_t(y), 0};
+            region.imageExtent = {width, rows, 1};
+            vkCmdCopyBufferToImage(commands(), ring_.get(), dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+            ++stats_.copies;
+        }
+        stats_.activeMs += sw.elapsedMs();
+    }
+
+    void UploadContext::copyLevelsToImage(const void *data, const ImageLevel *levels, uint32_t levelCount,
+                                          uint32_t blockDim, uint32_t blockBytes, VkImage dst)
+    {
+        if (!data || !levels || levelCount == 0 || blockDim == 0 || blockBytes == 0)
+            return;
+
+        Core::Stopwatch sw;
+        const VkDeviceSize maxChunk = ringSize_ / 2;
+        // bufferOffset must be a multiple of the block size and of 4
+        const VkDeviceSize alignment = std::lcm(VkDeviceSize(blockBytes), VkDeviceSize(16));
+        const auto *src = static_cast<const std::byte *>(data);
+
+        auto region = [](VkDeviceSize bufferOffset, uint32_t mip, uint32_t y, uint32_t width, uint32_t height)
+        {
+            VkBufferImageCopy r{};
+            r.bufferOffset = bufferOffset;
+            r.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            r.imageSubresource.mipLevel = mip;
+            r.imageSubresource.layerCount = 1;
+            r.imageOffset = {0, int32_t(y), 0};
+            r.imageExtent = {width, height, 1};
+            return r;
+        };
+
+        // 1) Whole chain in one staging range -> one copy command with a region per mip
+        VkDeviceSize total = 0;
+        for (uint32_t i = 0; i < levelCount; ++i)
+            total = alignUp(total, alignment) + levels[i].bytes;
+
+        if (total <= maxChunk)
+        {
+            const VkDeviceSize base = acquire(total, alignment);
+            std::vector<VkBufferImageCopy> regions(levelCount);
+
+            VkDeviceSize cursor = 0;
+            for (uint32_t i = 0; i < levelCount; ++i)
+            {
+                cursor = alignUp(cursor, alignment);
+                write(base + cursor, src + levels[i].offset, levels[i].bytes);
+                regions[i] = region(base + cursor, i, 0, levels[i].width, levels[i].height);
+                cursor += levels[i].bytes;
+            }
+
+            vkCmdCopyBufferToImage(commands(), ring_.get(), dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                   levelCount, regions.data());
+            ++stats_.copies;
+            stats_.activeMs += sw.elapsedMs();
+            return;
+        }
+
+        // 2) Oversized chain: per level, in bands of whole block rows
+        for (uint32_t i = 0; i < levelCount; ++i)
+        {
+            const ImageLevel &level = levels[i];
+            const uint32_t blockRows = (level.height + blockDim - 1) / blockDim;
+            const VkDeviceSize rowBytes = VkDeviceSize((level.width + blockDim - 1) / blockDim) * blockBytes;
+            if (rowBytes > maxChunk)
+                throw std::runtime_error("UploadContext::copyLevelsToImage(): one block row exceeds half the staging ring");
+            if (rowBytes * blockRows != level.bytes)
+                throw std::runtime_error("UploadContext::copyLevelsToImage(): level size doesn't match its extent");
+
+            const uint32_t rowsPerChunk = bandRows(blockRows, maxChunk / rowBytes);
+            if (rowsPerChunk == 0)
+                throw std::runtime_error("UploadContext::copyLevelsToImage(): one granularity band exceeds half the staging ring");
+            for (uint32_t row = 0; row < blockRows; row += rowsPerChunk)
+            {
+                const uint32_t rows = std::min(rowsPerChunk, blockRows - row);
+                const VkDeviceSize bytes = rowBytes * rows;
+                const VkDeviceSize offset = acquire(bytes, alignment);
+                write(offset, src + level.offset + rowBytes * row, bytes);
+
+                // The last band may end on a partial block: clamp to the mip's real height
+                const uint32_t y = row * blockDim;
+                const VkBufferImageCopy r = region(offset, i, y, level.width, std::min(rows * blockDim, level.height - y));
+                vkCmdCopyBufferToImage(commands(), ring_.get(), dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &r);
+                ++stats_.copies;
+            }
+        }
+        stats_.activeMs += sw.elapsedMs();
+    }
+
+    uint32_t UploadContext::bandRows(uint32_t rows, VkDeviceSize fitRows) const noexcept
+    {
+        if (fitRows >= rows)
+            return rows;
+        return uint32_t(fitRows / bandRowMultiple_ * bandRowMultiple_);
+    }
+
+    uint64_t UploadContext::submit()
+    {
+        if (!recording_)
+            return lastSubmitted_;
+
+        // 1) Make transfer writes (copies, blits) visible to every later consumer on the graphics queue
+        VkCommandBuffer gfx = current_.gfxCmd ? current_.gfxCmd : current_.cmd;
+        VkMemoryBarrier barrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                                VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(gfx,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                             0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        VK_CHECK(vkEndCommandBuffer(current_.cmd));
+        if (current_.gfxCmd)
+            VK_CHECK(vkEndCommandBuffer(current_.gfxCmd));
+
+        // 2) Cross-family: copies on the transfer queue signal the semaphore the graphics half waits on
+        if (current_.gfxCmd)
+        {
+            VkSubmitInfo si{VK_STRUCTURE_TYPE_SUBMIT_INFO};
+            si.commandBufferCount = 1;
+            si.pCommandBuffers = &current_.cmd;
+            si.signalSemaphoreCount = 1;
+            si.pSignalSemaphores = &current_.copiesDone;
+            VK_CHECK(vkQueueSubmit(transferQueue_, 1, &si, VK_NULL_HANDLE));
+            ++stats_.submits;
+        }
+
+        // 3) The batch fence rides on the last submit (the only one with a single family)
+        const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        VkSubmitInfo si{VK_STRUCTURE_TYPE_SUBMIT_INFO};
+        si.commandBufferCount = 1;
+        si.pCommandBuffers = &gfx;
+        if (current_.gfxCmd)
+        {
+            si.waitSemaphoreCount = 1;
+            si.pWaitSemaphores = &current_.copiesDone;
+            si.pWaitDstStageMask = &waitStage;
+        }
+        VK_CHECK(vkQueueSubmit(current_.gfxCmd ? graphicsQueue_ : transferQueue_, 1, &si, current_.fence));
+        ++stats_.submits;
+        current_.submitted = std::chrono::steady_clock::now();
+
+        current_.ticket = nextTicket_++;
+        lastSubmitted_ = current_.ticket;
+        inFlight_.push_back(current_);
+        current_ = Batch{};
+        recording_ = false;
+        return lastSubmitted_;
+    }
+
+    void UploadContext::wait(uint64_t ticket)
+    {
+        Core::Stopwatch sw;
+        waitUntil(ticket);
+        stats_.activeMs += sw.elapsedMs();
+    }
+
+    void UploadContext::waitUntil(uint64_t ticket)
+    {
+        while (!inFlight_.empty() && inFlight_.front().ticket <= ticket)
+        {
+            Batch &b = inFlight_.front();
+            if (vkGetFenceStatus(device_, b.fence) != VK_SUCCESS)
+            {
+                VK_CHECK(vkWaitForFences(device_, 1, &b.fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+                ++stats_.waits;
+            }
+            retire(b);
+            inFlight_.pop_front();
+        }
+    }
+
+    void UploadContext::poll()
+    {
+        // Non-blocking: stop at the first batch still executing (completion is in submit order)
+        while (!inFlight_.empty() && vkGetFenceStatus(device_, inFlight_.front().fence) == VK_SUCCESS)
+        {
+            retire(inFlight_.front());
+            inFlight_.pop_front();
+        }
+    }
+
+    bool UploadContext::isComplete(uint64_t ticket)
+    {
+        poll();
+        return ticket <= lastCompleted_;
+    }
+
+    void UploadContext::retire(Batch &batch)
+    {
+        // 1) Latency as observed by the host (poll/wait granularity)
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - batch.submitted).count();
+        ++stats_.batchesCompleted;
+        stats_.latencyMsTotal += ms;
+        stats_.latencyMsMax = std::max(stats_.latencyMsMax, ms);
+        lastCompleted_ = batch.ticket;
+
+        // 2) The GPU is done reading this batch's ring range; batches retire in order
+        ringTail_ = std::max(ringTail_, batch.ringEnd);
+        batch.ticket = 0;
+        VK_CHECK(vkResetFences(device_, 1, &batch.fence));
+        free_.push_back(batch);
+    }
+
+} // namespace Vk
@@ -37,9 +37,11 @@ namespace Vk
         const auto indices = physicalDevice.getQueueFamilies();
         graphicsQueueFamilyIndex_ = indices.graphicsFamily.value();
         presentQueueFamilyIndex_ = indices.presentFamily.value();
+        transferQueueFamilyIndex_ = indices.transferFamily.value_or(graphicsQueueFamilyIndex_);
         std::set<uint32_t> uniqueFamilies = {
             indices.graphicsFamily.value(),
-            indices.presentFamily.value()};
+            indices.presentFamily.value(),
+            transferQueueFamilyIndex_};
 
         std::vector<VkDeviceQueueCreateInfo> queueInfos;
         float prio = 1.0f;
@@ -83,12 +85,50 @@ namespace Vk
         VkPhysicalDeviceFeatures coreFeatures{}; // keep default-off core features
         coreFeatures.samplerAnisotropy = VK_TRUE;
 
+        // BC1-7 sampling (cooked textures); optional — without it materials fall back to RGBA8
+        VkPhysicalDeviceFeatures supported{};
+        vkGetPhysicalDeviceFeatures(physicalDevice.getDevice(), &supported);
+        if (supported.textureCompressionBC)
+        {
+            bool formatsOk = true;
+            for (VkFormat f : {VK_FORMAT_BC4_UNORM_BLOCK, VK_FORMAT_BC5_UNORM_BLOCK,
+                               VK_FORMAT_BC7_UNORM_BLOCK, VK_FORMAT_BC7_SRGB_BLOCK})
+            {
+                VkFormatProperties props{};
+                vkGetPhysicalDeviceFormatProperties(physicalDevice.getDevice(), f, &props);
+                const VkFormatFeatureFlags need = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT |
+                                                  VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT |
+                                                  VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+                formatsOk = formatsOk && (props.optimalTilingFeatures & need) == need;
+            }
+            // Only enabled when the renderer will actually sample BC textures
+            if (formatsOk)
+            {
+                coreFeatures.textureCompressionBC = VK_TRUE;
+                blockCompression_ = true;
+            }
+        }
+
+        // GPU-driven draws (Vk::GpuDrivenPass); optional — without them only the CPU draw list is used
+        VkPhysicalDeviceVulkan12Features supported12{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES};
+        VkPhysicalDeviceFeatures2 supported2{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2};
+        supported2.pNext = &supported12;
+        vkGetPhysicalDeviceFeatures2(physicalDevice.getDevice(), &supported2);
+
+        VkPhysicalDeviceVulkan12Features v12{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES};
+        if (supported12.drawIndirectCount && supported.multiDrawIndirect && supported.drawIndirectFirstInstance)
+        {
+            v12.drawIndirectCount = VK_TRUE;
+            coreFeatures.multiDrawIndirect = VK_TRUE;
+            coreFeatures.drawIndirectFirstInstance = VK_TRUE;
+            indirectCount_ = true;
+        }
+
         VkPhysicalDeviceVulkan13Features v13{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES};
+        v13.pNext = &v12;
         v13.synchronization2 = VK_TRUE;
         v13.dynamicRendering = VK_TRUE;
 
-        // If you’ll need 1.2/1.1 features in future, chain them here before v13.
-
         // --- 4) Create device ---
         VkDeviceCreateInfo ci{VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
         ci.pNext = &v13;
@@ -104,9 +144,16 @@ namespace Vk
         // --- 5) Fetch queues ---
         vkGetDeviceQueue(device, indices.graphicsFamily.value(), 0, &graphicsQueue);
         vkGetDeviceQueue(device, indices.presentFamily.value(), 0, &presentQueue);
+        vkGetDeviceQueue(device, transferQueueFamilyIndex_, 0, &transferQueue);
 
         Core::Logger::log(LogLevel::INFO, "Logical device created (VK_KHR_swapchain enabled)");
         Core::Logger::log(LogLevel::INFO, "Graphics & present queues retrieved");
+        Core::Logger::log(LogLevel::INFO, hasDedicatedTransferQueue()
+                                              ? "Transfer queue: dedicated family " + std::to_string(transferQueueFamilyIndex_)
+                                              : std::string("Transfer queue: none dedicated, uploads share the graphics queue"));
+        Core::Logger::log(LogLevel::INFO, blockCompression_
+                                              ? "Texture compression: BC4/BC5/BC7 enabled"
+                                              : "Texture compression: BC unsupported, textures stay RGBA8");
     }
 
     VulkanLogicalDevice::~VulkanLogicalDevice() noexcept
@@ -118,6 +118,30 @@ namespace Vk
                 break;
         }
 
+        // Dedicated copy queue: prefer a transfer-only family (DMA engine), else any non-graphics one with TRANSFER.
+        // A (0,0,0) image granularity only allows whole-mip copies, which banded texture uploads can't honour:
+        // skip such families (uploads then share the graphics queue)
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const VkQueueFlags f = props[i].queueFlags;
+            if (!(f & VK_QUEUE_TRANSFER_BIT) || (f & VK_QUEUE_GRAPHICS_BIT) || props[i].queueCount == 0)
+                continue;
+
+            const VkExtent3D g = props[i].minImageTransferGranularity;
+            if (g.width == 0 || g.height == 0 || g.depth == 0)
+                continue;
+
+            if (!(f & VK_QUEUE_COMPUTE_BIT))
+            {
+                indices.transferFamily = i;
+                break;
+            }
+            if (!indices.transferFamily)
+                indices.transferFamily = i;
+        }
+        if (indices.transferFamily)
+            indices.transferGranularity = props[*indices.transferFamily].minImageTransferGranularity;
+
         return indices;
     }
 
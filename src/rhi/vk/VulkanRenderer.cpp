@@ -1,6 +1,7 @@
 #include "rhi/vk/VulkanRenderer.h"
 
 #include "core/Logger.h"
+#include "core/Stopwatch.h"
 
 #include "rhi/vk/VulkanInstance.h"
 #include "rhi/vk/Surface.h"
@@ -16,12 +17,18 @@
 #include "rhi/vk/SyncObjects.h"
 #include "rhi/vk/RendererContext.h"
 #include "rhi/vk/FrameRenderer.h"
+#include "rhi/vk/GpuDrivenPass.h"
 #include "rhi/vk/DepthResources.h"
+#include "rhi/vk/UploadBenchmark.h"
+#include "rhi/vk/UploadContext.h"
 #include "rhi/vk/Common.h"
 
 #include "rhi/vk/memoryManager/VulkanAllocator.h"
 
+#include "rhi/vk/gfx/Buffer.h"
+#include "rhi/vk/gfx/GeometryArena.h"
 #include "rhi/vk/gfx/Mesh.h"
+#include "rhi/vk/gfx/StreamingIndexBuffer.h"
 #include "rhi/vk/gfx/Vertex.h"
 
 #include "render/OrbitCamera.h"
@@ -29,10 +36,12 @@
 #include "render/CameraController.h"
 #include "render/Scene.h"
 #include "render/WorkshopScene.h"
+#include "render/StressScene.h"
 #include "render/ViewUniforms.h"
 #include "render/materials/Material.h"
 #include "render/materials/MaterialSystem.h"
 #include "render/LightManager.h"
+#include "render/DrawListBuilder.h"
 
 #include "input/InputSystem.h"
 
@@ -50,6 +59,7 @@ using namespace Core::MathUtils;
 using Vk::Gfx::Utils::computeWorldAABB;
 
 #include <glm/glm.hpp>
+#include <algorithm>
 #include <chrono>
 
 namespace Vk
@@ -67,6 +77,8 @@ namespace Vk
     {
         Logger::log(LogLevel::INFO, "VulkanRenderer initialized");
 
+        config = Core::EngineConfig::load("engine.cfg");
+
         // Defer swapchain recreation to the beginning of a frame
         window.onFramebufferResize = [&](int /*w*/, int /*h*/)
         { markSwapchainDirty(); };
@@ -121,14 +133,30 @@ namespace Vk
         syncObjects = std::make_unique<SyncObjects>(logicalDevice->getDevice(),
                                                     static_cast<uint32_t>(swapChain->getImages().size()));
 
+        // Content uploads below are recorded into one batch and submitted together
+        // (copies on the dedicated transfer queue when the GPU has one)
+        uploadContext = std::make_unique<UploadContext>(allocator->get(), logicalDevice->getDevice(),
+                                                        logicalDevice->getTransferQueueFamilyIndex(),
+                                                        logicalDevice->getTransferQueue(),
+                                                        logicalDevice->getGraphicsQueueFamilyIndex(),
+                                                        logicalDevice->getGraphicsQueue(),
+                                                        VkDeviceSize(config.stagingRingMiB) << 20,
+                                                        physicalDevice->getQueueFamilies().transferGranularity);
+
         // --- Materials system (we still create it here, because it depends on VkDevice etc.) -----------------
         materials = std::make_unique<Render::MaterialSystem>();
-        materials->setUploadCmd(commandPool->get(), logicalDevice->getGraphicsQueue());
+        materials->setUploadContext(*uploadContext);
+        // Textures are mip-mapped + block-compressed once and loaded from disk afterwards
+        materials->setTextureCooking("cache/textures", logicalDevice->supportsBlockCompression());
+        // Shared samplers clamp their anisotropy to the device limit
+        VkPhysicalDeviceProperties deviceProps{};
+        vkGetPhysicalDeviceProperties(physicalDevice->getDevice(), &deviceProps);
         materials->init(
             allocator->get(),
             logicalDevice->getDevice(),
             graphicsPipeline->getMaterialSetLayout(),
-            /*maxMaterials*/ 128);
+            /*maxMaterials*/ 128,
+            deviceProps.limits.maxSamplerAnisotropy);
 
         lightMgr = std::make_unique<Render::LightManager>();
         lightMgr->init(
@@ -137,9 +165,24 @@ namespace Vk
             graphicsPipeline->getLightingSetLayout());
 
         // --- Create Scene and load content ------------------------------------
-        scene = std::make_unique<Render::WorkshopScene>();
+        // Every mesh suballocates its vertices/indices from shared pages (one bind per page when drawing)
+        geometry = std::make_unique<Gfx::GeometryArena>(allocator->get(), logicalDevice->getDevice(),
+                                                        VkDeviceSize(config.geometryVertexPageMiB) << 20,
+                                                        VkDeviceSize(config.geometryIndexPageMiB) << 20);
 
-        static_cast<Render::WorkshopScene *>(scene.get())->build(allocator->get(), logicalDevice->getDevice(), commandPool->get(), logicalDevice->getGraphicsQueue(), *materials);
+        if (config.stressSceneObjects > 0)
+        {
+            // Draw-call stress test: thousands of identical objects (see Render::StressScene)
+            auto stress = std::make_unique<Render::StressScene>();
+            stress->build(*uploadContext, *geometry, *materials, config.stressSceneObjects);
+            scene = std::move(stress);
+        }
+        else
+        {
+            auto workshop = std::make_unique<Render::WorkshopScene>();
+            workshop->build(*uploadContext, *geometry, *materials);
+            scene = std::move(workshop);
+        }
 
         {
             using namespace Render;
@@ -181,9 +224,37 @@ namespace Vk
             // }
 
             // 5) Upload all lighting buffers (UBO + SSBOs). This will (re)grow SSBOs if needed.
-            lightMgr->upload(commandPool->get(), logicalDevice->getGraphicsQueue(), ambientRGB, lightingFlags);
+            lightMgr->upload(*uploadContext, ambientRGB, lightingFlags);
         }
 
+        // Everything above lands with a few submits through the staging ring (or direct writes on UMA)
+        {
+            uploadContext->flush();
+            const UploadContext::Stats &us = uploadContext->stats();
+            const auto mib = [](double bytes)
+            { return std::to_string(static_cast<uint64_t>(bytes / (1024.0 * 1024.0))); };
+            CORE_LOG_INFO("Upload: " + std::to_string(us.copies) + " copies, " + mib(double(us.stagedBytes)) +
+                          " MiB staged at " + mib(us.bytesPerSecond()) + " MiB/s, " +
+                          std::to_string(us.submits) + " submits, " + std::to_string(us.waits) + " waits, ring " +
+                          mib(double(us.ringPeakBytes)) + "/" + mib(double(uploadContext->ringCapacity())) +
+                          " MiB peak, " + std::to_string(us.ringStalls) + " wrap stalls; direct writes: " +
+                          std::to_string(us.directWrites) + " (" + mib(double(us.directBytes)) + " MiB at " +
+                          mib(us.directBytesPerSecond()) + " MiB/s); " +
+                          (uploadContext->crossFamily() ? "transfer queue" : "graphics queue") + ", " +
+                          std::to_string(us.batchesCompleted) + " batches, " +
+                          std::to_string(us.averageLatencyMs()) + " ms avg latency");
+
+            const Gfx::GeometryArena::Stats gs = geometry->stats();
+            CORE_LOG_INFO("Geometry: " + std::to_string(gs.liveRanges) + " meshes in " + std::to_string(gs.pages) +
+                          " page(s) / " + std::to_string(gs.vmaAllocations) + " allocations, vertices " +
+                          mib(double(gs.vertexBytesUsed)) + "/" + mib(double(gs.vertexBytesCapacity)) + " MiB, indices " +
+                          mib(double(gs.indexBytesUsed)) + "/" + mib(double(gs.indexBytesCapacity)) + " MiB");
+        }
+
+        // Optional upload throughput per path (after the startup stats so they stay about the scene)
+        if (config.uploadBenchMiB > 0)
+            runUploadBenchmark(*logicalDevice, allocator->get(), *uploadContext, VkDeviceSize(config.uploadBenchMiB) << 20);
+
         allocator->logBudgets();
         allocator->dumpStatsToFile("vma_stats_after_loadModel.json", true);
 
@@ -196,23 +267,34 @@ namespace Vk
         // --- Renderer context + per-image View UBO/sets ---------------------------
         ctx = std::make_unique<RendererContext>(*instance, *physicalDevice, *logicalDevice, *swapChain, *commandBuffers, *commandPool,
                                                 *syncObjects, *renderPass, *graphicsPipeline, *imageViews, *depth, nullptr);
-        // The RendererContext only needs the list of meshes to draw (of DrawItems).
-        // Currently RendererContext::drawList was std::vector<const Mesh*>.
-        // We can still give it the meshes indirectly via scene->drawItems().
-        //
-        // Option A: keep ctx->drawList == vector<const Mesh*> for now:
+        // Scene command buffers are recorded every frame from the builder's list (see FrameRenderer)
+        drawListBuilder = std::make_unique<Render::DrawListBuilder>();
+        ctx->frameDrawItems = &drawListBuilder->items();
+        ctx->frameObjects = &drawListBuilder->objects();
+        ctx->lightingSet = lightMgr->lightingSet();
+
+        // Visible meshlet indices are streamed per swapchain image right before recording
+        clusterIndexStream = std::make_unique<Gfx::StreamingIndexBuffer>();
+        clusterIndexStream->create(allocator->get(), logicalDevice->getDevice(),
+                                   static_cast<uint32_t>(swapChain->getImages().size()));
+        ctx->clusterIndices = clusterIndexStream.get();
+        ctx->prepareImage = [this](uint32_t imageIndex)
         {
-            ctx->drawList.clear();
-            ctx->drawList.reserve(scene->drawItems().size());
-            for (auto &di : scene->drawItems())
-            {
-                ctx->drawList.push_back(di.mesh); // di.mesh is Mesh*
-            }
-        }
+            if (ctx->gpuDriven)
+                ctx->gpuDriven->prepare(imageIndex, camera->proj() * camera->view());
+            else
+                drawListBuilder->cullClusters(*clusterIndexStream, imageIndex);
+        };
 
         // Allocates UBO buffers and descriptor sets (set=0)
         ctx->createViewResources(physicalDevice->getDevice());
 
+        // GPU-driven alternative to the draw list (scene objects uploaded once)
+        createGpuDrivenPass();
+        gpuDrivenEnabled = config.gpuDriven != 0 && gpuDriven;
+        if (config.gpuDriven != 0 && !gpuDriven)
+            CORE_LOG_WARN("VulkanRenderer: gpuDriven requested but drawIndirectCount is unsupported; using the CPU draw list");
+
         imguiLayer = std::make_unique<UI::ImGuiLayer>(*ctx, window);
         imguiLayer->initialize();
 
@@ -295,10 +377,7 @@ namespace Vk
         cameraController->setSlowMultiplier(0.2f);
         cameraController->setInvertForward(true);
 
-        // --- Record command buffers ----------------------------------------------
-        // drawItems we now get from Scene
-        const auto &drawItemsRef = scene->drawItems();
-
+        // --- Initial view UBOs (command buffers are recorded per frame) ----------
         for (uint32_t i = 0; i < swapChain->getImages().size(); ++i)
         {
             // Update per-image View UBO
@@ -309,11 +388,6 @@ namespace Vk
             u.cameraPos = glm::vec4(camera->position(), 1.0f); // std140-friendly
 
             ctx->updateViewUbo(i, u);
-
-            // Record for image i: pass descriptor set (set=0)
-            commandBuffers->record(i, *graphicsPipeline,
-                                   *swapChain, *imageViews, *depth,
-                                   drawItemsRef, ctx->viewSet(i), lightMgr->lightingSet());
         }
 
         // --- Frame loop driver -----------------------------------------------------
@@ -378,6 +452,26 @@ namespace Vk
             if (window.width() == 0 || window.height() == 0) // minimized
                 continue;
 
+            // Release finished upload batches; optionally keep the transfer queue busy
+            uploadContext->poll();
+            streamUploads(dt * 1000.0f);
+
+            // Per-frame draw list (LOD selection for the current camera); the GPU-driven path
+            // culls and builds its draws on the GPU instead (its buffers follow scene changes)
+            if (gpuDrivenEnabled && gpuDriven && gpuDriven->sceneGeneration() != scene->generation())
+            {
+                vkDeviceWaitIdle(logicalDevice->getDevice()); // frames in flight read the old buffers
+                gpuDriven->setScene(*uploadContext, scene->drawItems(),
+                                    drawListBuilder->sceneObjects(scene->drawItems(), scene->generation()),
+                                    scene->generation());
+            }
+            ctx->gpuDriven = gpuDrivenEnabled && gpuDriven && gpuDriven->ready() ? gpuDriven.get() : nullptr;
+            Core::Stopwatch buildTimer;
+            if (!ctx->gpuDriven)
+                drawListBuilder->build(scene->drawItems(), *camera, float(swapChain->getExtent().height),
+                                       scene->generation());
+            const double buildMs = ctx->gpuDriven ? 0.0 : buildTimer.elapsedMs();
+
             // --- DEBUG ImGui Window --- //
             if (imguiLayer)
             {
@@ -397,14 +491,163 @@ namespace Vk
                 ImGui::Text("Window: %dx%d", window.width(), window.height());
                 ImGui::Text("Present Mode: %s", swapChain->presentModeName().c_str());
 
+                // Per-frame visibility (frustum vs. item bounds, built above)
+                const Render::DrawListStats &ds = drawListBuilder->stats();
+                ImGui::Checkbox("Frustum culling", &drawListBuilder->visibilitySettings().frustum);
+                if (ctx->gpuDriven) // the draw list is not built this frame; its numbers would be stale
+                    ImGui::TextDisabled("Visible: n/a (GPU-driven culling)");
+                else
+                    ImGui::Text("Visible: %u / %u items (%.3f ms)", ds.itemsVisible, ds.items, ds.visibilityMs);
+
+                // GPU-driven path: compute frustum culling + one indirect-count draw per batch
+                if (gpuDriven)
+                {
+                    const GpuDrivenStats &gs = gpuDriven->stats();
+                    ImGui::Checkbox("GPU-driven culling", &gpuDrivenEnabled);
+                    ImGui::Text("GPU cull: %u objects, %u batches (%.3f ms GPU)", gs.objects, gs.batches, gs.cullGpuMs);
+                }
+                else
+                {
+                    ImGui::TextDisabled("GPU-driven culling: no drawIndirectCount");
+                }
+
+                // Upload queue + streaming test (frame time with and without background uploads)
+                ImGui::SeparatorText("Uploads");
+                ImGui::Text("Queue: %s", uploadContext->crossFamily() ? "dedicated transfer family" : "graphics (shared)");
+                ImGui::Checkbox("Stream uploads", &uploadStream.enabled);
+                ImGui::SliderInt("KiB / frame", &uploadStream.kibPerFrame, 64,
+                                 int(uploadContext->ringCapacity() / 2 / 1024));
+                ImGui::Text("Streamed: %llu batches, %llu busy frames",
+                            static_cast<unsigned long long>(uploadStream.uploads),
+                            static_cast<unsigned long long>(uploadStream.busyFrames));
+                ImGui::Text("Latency: %.2f ms (max %.2f ms overall)",
+                            uploadStream.latencyMs, uploadContext->stats().latencyMsMax);
+                ImGui::Text("Frame: %.2f ms streaming / %.2f ms idle",
+                            uploadStream.frameMsStreaming, uploadStream.frameMsIdle);
+
                 ImGui::End();
 
-                imguiLayer->drawVmaPanel(*allocator);
+                imguiLayer->drawVmaPanel(*allocator, materials->cacheStats());
+                imguiLayer->drawRenderPanel(*drawListBuilder, commandBuffers->recordStats());
                 imguiLayer->endFrame();
             }
 
             frameRenderer->drawFrame();
+
+            // Smoke run: exit after the configured number of frames
+            if (config.smokeFrames > 0 &&
+                smokeFrame(std::chrono::duration<double, std::milli>(clock::now() - now).count(), buildMs))
+                break;
+        }
+    }
+
+    void VulkanRenderer::createGpuDrivenPass()
+    {
+        // Devices without drawIndirectCount keep the CPU draw list only
+        if (!logicalDevice->supportsIndirectCount())
+            return;
+
+        // 1) GPU timing only where graphics/compute queues support timestamps
+        VkPhysicalDeviceProperties props{};
+        vkGetPhysicalDeviceProperties(physicalDevice->getDevice(), &props);
+        const float timestampPeriod = props.limits.timestampComputeAndGraphics ? props.limits.timestampPeriod : 0.0f;
+
+        // 2) Pipeline, per-image state, then the scene's objects and batches
+        gpuDriven = std::make_unique<GpuDrivenPass>();
+        gpuDriven->create(allocator->get(), logicalDevice->getDevice(), timestampPeriod);
+        updateGpuDrivenImages();
+        gpuDriven->setScene(*uploadContext, scene->drawItems(),
+                            drawListBuilder->sceneObjects(scene->drawItems(), scene->generation()),
+                            scene->generation());
+    }
+
+    void VulkanRenderer::updateGpuDrivenImages()
+    {
+        if (!gpuDriven)
+            return;
+
+        // View UBOs of the current swapchain images (set 0, binding 0 of the pass's view sets)
+        std::vector<VkBuffer> viewUbos;
+        viewUbos.reserve(frameResources.size());
+        for (const FrameResources &fr : frameResources)
+            viewUbos.push_back(fr.viewUbo);
+
+        gpuDriven->setImages(graphicsPipeline->getViewSetLayout(), viewUbos);
+    }
+
+    void VulkanRenderer::streamUploads(float frameMs)
+    {
+        UploadStreamTest &st = uploadStream;
+        const auto smooth = [](double &avg, double v)
+        { avg = avg == 0.0 ? v : avg + 0.05 * (v - avg); };
+
+        // 1) Frame time goes to the bucket of the mode it ran in
+        smooth(st.enabled ? st.frameMsStreaming : st.frameMsIdle, frameMs);
+
+        // 2) Harvest the previous upload (poll() already ran this frame)
+        if (st.pendingTicket != 0)
+        {
+            if (!uploadContext->isComplete(st.pendingTicket))
+            {
+                ++st.busyFrames;
+                return;
+            }
+            smooth(st.latencyMs, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - st.submittedAt).count());
+            st.pendingTicket = 0;
+        }
+        if (!st.enabled)
+            return;
+
+        // 3) (Re)create the scratch destination; plain device-local so it always goes through the copy queue
+        const VkDeviceSize bytes = VkDeviceSize(st.kibPerFrame) << 10;
+        if (!st.target || st.target->size() < bytes)
+        {
+            st.target = std::make_unique<Gfx::Buffer>();
+            st.target->create(allocator->get(), logicalDevice->getDevice(), bytes,
+                              VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                              VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, 0, "Upload Stream Target");
+            st.payload.resize(static_cast<size_t>(bytes));
+            for (size_t i = 0; i < st.payload.size(); ++i)
+                st.payload[i] = std::byte(i * 31u);
         }
+
+        // 4) One batch per frame, submitted without waiting; the frame never depends on it
+        uploadContext->copyToBuffer(st.payload.data(), bytes, st.target->get());
+        st.pendingTicket = uploadContext->submit();
+        st.submittedAt = std::chrono::steady_clock::now();
+        ++st.uploads;
+    }
+
+    bool VulkanRenderer::smokeFrame(double frameMs, double buildMs)
+    {
+        SmokeRun &sr = smoke;
+
+        // 1) Skip the first tenth (pipeline warm-up, first uploads), sum the rest
+        if (++sr.frames > config.smokeFrames / 10)
+        {
+            ++sr.measured;
+            sr.frameMs += frameMs;
+            sr.buildMs += buildMs;
+            sr.recordMs += commandBuffers->recordStats().cpuMs;
+            if (ctx->gpuDriven)
+            {
+                sr.cullGpuMs += gpuDriven->stats().cullGpuMs;
+                ++sr.gpuFrames;
+            }
+        }
+        if (sr.frames < config.smokeFrames)
+            return false;
+
+        // 2) One line per run, averaged over the measured frames
+        const double n = std::max(1u, sr.measured);
+        CORE_LOG_INFO("Smoke: objects=" + std::to_string(scene->drawItems().size()) +
+                      " path=" + (sr.gpuFrames > 0 ? "gpu" : "cpu") +
+                      " frames=" + std::to_string(sr.measured) +
+                      " frameMs=" + std::to_string(sr.frameMs / n) +
+                      " drawListMs=" + std::to_string(sr.buildMs / n) +
+                      " recordMs=" + std::to_string(sr.recordMs / n) +
+                      " cullGpuMs=" + std::to_string(sr.gpuFrames > 0 ? sr.cullGpuMs / sr.gpuFrames : 0.0));
+        return true;
     }
 
     void VulkanRenderer::cleanup()
@@ -420,7 +663,11 @@ namespace Vk
 
         // 3) Destroy scene and materials early - they own Mesh/Textures/VkBuffer/VkImage etc.
         // This ensures Mesh destructors free their Vulkan handles while device is valid.
+        drawListBuilder.reset();
+        clusterIndexStream.reset();
+        gpuDriven.reset();
         scene.reset();
+        geometry.reset(); // after the scene: meshes return their ranges on destruction
         materials->shutdown();
         materials.reset();
 
@@ -452,7 +699,9 @@ namespace Vk
         renderPass.reset();
         depth.reset();
 
-        // 6) Sync objects, command pool, swapchain
+        // 6) Sync objects, command pools, swapchain
+        uploadStream.target.reset();
+        uploadContext.reset();
         syncObjects.reset();
         commandPool.reset();
         if (swapChain)
@@ -538,23 +787,30 @@ namespace Vk
         // 5) Recreate renderer context (pipeline/layout might have changed)
         ctx = std::make_unique<RendererContext>(*instance, *physicalDevice, *logicalDevice, *swapChain, *commandBuffers, *commandPool,
                                                 *syncObjects, *renderPass, *graphicsPipeline, *imageViews, *depth, nullptr);
+        ctx->frameDrawItems = &drawListBuilder->items();
+        ctx->frameObjects = &drawListBuilder->objects();
+        ctx->lightingSet = lightMgr->lightingSet();
+
+        // Slots are per image and the image count may have changed (the device is idle here)
+        if (clusterIndexStream->slotCount() != newImageCount)
+            clusterIndexStream->create(allocator->get(), logicalDevice->getDevice(), newImageCount);
+        ctx->clusterIndices = clusterIndexStream.get();
+        ctx->prepareImage = [this](uint32_t imageIndex)
         {
-            ctx->drawList.clear();
-            ctx->drawList.reserve(scene->drawItems().size());
-            for (auto &di : scene->drawItems())
-            {
-                ctx->drawList.push_back(di.mesh);
-            }
-        }
+            if (ctx->gpuDriven)
+                ctx->gpuDriven->prepare(imageIndex, camera->proj() * camera->view());
+            else
+                drawListBuilder->cullClusters(*clusterIndexStream, imageIndex);
+        };
         ctx->createViewResources(physicalDevice->getDevice());
+        updateGpuDrivenImages(); // its view sets reference the new UBOs / set layout; scene buffers are kept
 
         // 6) Recreate ImGuiLayer ПОСЛЕ создания ctx
         imguiLayer = std::make_unique<UI::ImGuiLayer>(*ctx, window);
         imguiLayer->initialize();
         ctx->imguiLayer = imguiLayer.get();
 
-        // 7) Record new command buffers (and refresh UBOs)
-        const auto &drawItemsRef = scene->drawItems();
+        // 7) Refresh UBOs (command buffers are recorded per frame)
         for (uint32_t i = 0; i < swapChain->getImages().size(); ++i)
         {
             Render::ViewUniforms u{};
@@ -564,10 +820,6 @@ namespace Vk
             u.cameraPos = glm::vec4(camera->position(), 1.0f);
 
             ctx->updateViewUbo(i, u);
-
-            commandBuffers->record(i, *graphicsPipeline,
-                                   *swapChain, *imageViews, *depth,
-                                   drawItemsRef, ctx->viewSet(i), lightMgr->lightingSet());
         }
 
         // 8) Recreate driver
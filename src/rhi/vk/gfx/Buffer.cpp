@@ -1,6 +1,7 @@
 #include "rhi/vk/gfx/Buffer.h"
 #include "rhi/vk/Common.h" // VK_CHECK
 #include "rhi/vk/DebugUtils.h"
+#include "rhi/vk/UploadContext.h"
 
 #include <cstring> // std::memcpy>
 #include <algorithm>
@@ -35,6 +36,7 @@ namespace Vk::Gfx
 
         // If created with MAPPED flag, VMA returns persistent mapping in info.pMappedData
         mapped_ = info.pMappedData;
+        vmaGetAllocationMemoryProperties(allocator_, allocation_, &memProps_);
 
         if (debugName && *debugName)
         {
@@ -55,6 +57,23 @@ namespace Vk::Gfx
         allocator_ = VK_NULL_HANDLE;
         size_ = 0;
         mapped_ = nullptr;
+        memProps_ = 0;
+    }
+
+    void Buffer::createDeviceLocal(VmaAllocator allocator,
+                                   VkDevice device,
+                                   VkDeviceSize sz,
+                                   VkBufferUsageFlags usage,
+                                   const char *debugName)
+    {
+        // AUTO prefers DEVICE_LOCAL; ALLOW_TRANSFER_INSTEAD lets VMA pick a non-mappable type
+        // when no DEVICE_LOCAL | HOST_VISIBLE one exists, MAPPED maps it when it does.
+        create(allocator, device, sz, usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+               VMA_MEMORY_USAGE_AUTO,
+               VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                   VMA_ALLOCATION_CREATE_HOST_ACCESS_ALLOW_TRANSFER_INSTEAD_BIT |
+                   VMA_ALLOCATION_CREATE_MAPPED_BIT,
+               debugName);
     }
 
     void *Buffer::map()
@@ -94,71 +113,17 @@ namespace Vk::Gfx
         // We keep it simple and rely on HOST_ACCESS flags for staging buffers.
     }
 
-    void Buffer::copyBuffer(VkDevice device,
-                            VkCommandPool cmdPool,
-                            VkQueue queue,
-                            VkBuffer src,
-                            VkBuffer dst,
-                            VkDeviceSize bytes)
-    {
-        // Allocate a one-time command buffer
-        VkCommandBufferAllocateInfo ai{VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
-        ai.commandPool = cmdPool;
-        ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        ai.commandBufferCount = 1;
-
-        VkCommandBuffer cmd = VK_NULL_HANDLE;
-        VK_CHECK(vkAllocateCommandBuffers(device, &ai, &cmd));
-
-        VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
-        bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        VK_CHECK(vkBeginCommandBuffer(cmd, &bi));
-
-        VkBufferCopy region{};
-        region.srcOffset = 0;
-        region.dstOffset = 0;
-        region.size = bytes;
-        vkCmdCopyBuffer(cmd, src, dst, 1, &region);
-
-        VK_CHECK(vkEndCommandBuffer(cmd));
-
-        VkSubmitInfo si{VK_STRUCTURE_TYPE_SUBMIT_INFO};
-        si.commandBufferCount = 1;
-        si.pCommandBuffers = &cmd;
-
-        VK_CHECK(vkQueueSubmit(queue, 1, &si, VK_NULL_HANDLE));
-        VK_CHECK(vkQueueWaitIdle(queue));
-
-        vkFreeCommandBuffers(device, cmdPool, 1, &cmd);
-    }
-
-    void Buffer::createDeviceLocalWithData(VmaAllocator allocator,
-                                           VkDevice device,
-                                           VkCommandPool cmdPool,
-                                           VkQueue queue,
+    void Buffer::createDeviceLocalWithData(UploadContext &upload,
                                            const void *data,
                                            VkDeviceSize bytes,
                                            VkBufferUsageFlags usage,
                                            const char *debugName)
     {
-        // 1) Create GPU-only destination
-        create(allocator, device, bytes, usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-               VMA_MEMORY_USAGE_GPU_ONLY, 0, debugName);
-
-        // 2) Create transient staging buffer (host visible + persistently mapped)
-        Buffer staging;
-        std::string stagingName = (debugName && *debugName) ? (std::string(debugName) + " Staging") : std::string();
-        staging.create(allocator, device, bytes,
-                       VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                       VMA_MEMORY_USAGE_CPU_TO_GPU,
-                       VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
-                           VMA_ALLOCATION_CREATE_MAPPED_BIT,
-                       stagingName.empty() ? nullptr : stagingName.c_str());
-        staging.upload(data, static_cast<size_t>(bytes));
-
-        // 3) Issue copy and drop staging
-        copyBuffer(device, cmdPool, queue, staging.get(), get(), bytes);
-        staging.destroy();
+        // 1) Device-local destination (host-visible too on UMA / ReBAR)
+        createDeviceLocal(upload.allocator(), upload.device(), bytes, usage, debugName);
+
+        // 2) Direct write when mapped, otherwise staged copy through the upload ring
+        upload.writeBuffer(*this, data, bytes);
     }
 
 } // namespace Vk::Gfx
@@ -0,0 +1,177 @@
+#include "rhi/vk/gfx/GeometryArena.h"
+#include "rhi/vk/UploadContext.h"
+#include "core/Logger.h"
+
+#include <algorithm>
+#include <string>
+
+namespace Vk::Gfx
+{
+    // ------------------------------------------------------------------------
+    // Free list
+    // ------------------------------------------------------------------------
+    GeometryArena::FreeList::FreeList(uint32_t capacity) : capacity_(capacity)
+    {
+        if (capacity_ > 0)
+            free_.emplace(0u, capacity_);
+    }
+
+    std::optional<uint32_t> GeometryArena::FreeList::allocate(uint32_t count)
+    {
+        if (count == 0)
+            return 0u;
+
+        // First fit keeps the low end of the page dense
+        for (auto it = free_.begin(); it != free_.end(); ++it)
+        {
+            if (it->second < count)
+                continue;
+
+            const uint32_t offset = it->first;
+            const uint32_t remaining = it->second - count;
+            free_.erase(it);
+            if (remaining > 0)
+                free_.emplace(offset + count, remaining);
+            used_ += count;
+            return offset;
+        }
+        return std::nullopt;
+    }
+
+    void GeometryArena::FreeList::release(uint32_t offset, uint32_t count) noexcept
+    {
+        if (count == 0)
+            return;
+        used_ -= count;
+
+        // 1) Merge with the following block
+        auto next = free_.lower_bound(offset);
+        if (next != free_.end() && offset + count == next->first)
+        {
+            count += next->second;
+            next = free_.erase(next);
+        }
+
+        // 2) Merge with the preceding block, otherwise insert
+        if (next != free_.begin())
+        {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == offset)
+            {
+                prev->second += count;
+                return;
+            }
+        }
+        free_.emplace_hint(next, offset, count);
+    }
+
+    // ------------------------------------------------------------------------
+    // Arena
+    // ------------------------------------------------------------------------
+    GeometryArena::GeometryArena(VmaAllocator allocator,
+                                 VkDevice device,
+                                 VkDeviceSize vertexPageBytes,
+                                 VkDeviceSize indexPageBytes)
+        : allocator_(allocator), device_(device),
+          vertexPageBytes_(vertexPageBytes), indexPageBytes_(indexPageBytes)
+    {
+        if (vertexPageBytes_ < sizeof(Vertex) || indexPageBytes_ < sizeof(uint32_t))
+            throw std::runtime_error("GeometryArena: page size too small");
+    }
+
+    uint32_t GeometryArena::addPage(uint32_t vertexCount, uint32_t indexCount)
+    {
+        // Oversized meshes get a page of their own size
+        const uint32_t vertexCapacity = static_cast<uint32_t>(
+            std::max<VkDeviceSize>(vertexPageBytes_ / sizeof(Vertex), vertexCount));
+        const uint32_t indexCapacity = static_cast<uint32_t>(
+            std::max<VkDeviceSize>(indexPageBytes_ / sizeof(uint32_t), indexCount));
+
+        const std::string name = "Geometry Page " + std::to_string(pages_.size());
+        Page page;
+        page.vertices.createDeviceLocal(allocator_, device_, VkDeviceSize(vertexCapacity) * sizeof(Vertex),
+                                        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, (name + " VB").c_str());
+        page.indices.createDeviceLocal(allocator_, device_, VkDeviceSize(indexCapacity) * sizeof(uint32_t),
+                                       VK_BUFFER_USAGE_INDEX_BUFFER_BIT, (name + " IB").c_str());
+        page.vertexSpace = FreeList(vertexCapacity);
+        page.indexSpace = FreeList(indexCapacity);
+        pages_.push_back(std::move(page));
+
+        CORE_LOG_DEBUG("GeometryArena: created " + name + " (" + std::to_string(vertexCapacity) + " vertices, " +
+                       std::to_string(indexCapacity) + " indices)");
+        return static_cast<uint32_t>(pages_.size() - 1);
+    }
+
+    bool GeometryArena::tryAllocate(uint32_t page, uint32_t vertexCount, uint32_t indexCount, Range &out)
+    {
+        Page &p = pages_[page];
+        const std::optional<uint32_t> v = p.vertexSpace.allocate(vertexCount);
+        if (!v)
+            return false;
+        const std::optional<uint32_t> i = p.indexSpace.allocate(indexCount);
+        if (!i)
+        {
+            // Vertices fit but the index list is full/fragmented: undo
+            p.vertexSpace.release(*v, vertexCount);
+            return false;
+        }
+
+        out = Range{page, *v, vertexCount, *i, indexCount};
+        ++p.liveRanges;
+        return true;
+    }
+
+    GeometryArena::Range GeometryArena::allocate(UploadContext &upload,
+                                                 std::span<const Vertex> vertices,
+                                                 std::span<const uint32_t> indices)
+    {
+        if (vertices.empty() && indices.empty())
+            return {};
+
+        const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+        const uint32_t indexCount = static_cast<uint32_t>(indices.size());
+
+        // 1) First page with room in both buffers, else a new one (always fits)
+        Range r{};
+        bool placed = false;
+        for (uint32_t p = 0; p < pages_.size() && !placed; ++p)
+            placed = tryAllocate(p, vertexCount, indexCount, r);
+        if (!placed && !tryAllocate(addPage(vertexCount, indexCount), vertexCount, indexCount, r))
+            throw std::logic_error("GeometryArena: fresh page cannot hold the mesh");
+
+        // 2) Record the copies (or direct writes on UMA / ReBAR)
+        Page &page = pages_[r.page];
+        upload.writeBuffer(page.vertices, vertices.data(), vertices.size_bytes(), VkDeviceSize(r.baseVertex) * sizeof(Vertex));
+        upload.writeBuffer(page.indices, indices.data(), indices.size_bytes(), VkDeviceSize(r.firstIndex) * sizeof(uint32_t));
+        return r;
+    }
+
+    void GeometryArena::free(const Range &range) noexcept
+    {
+        if (!range.valid() || range.page >= pages_.size())
+            return;
+
+        Page &page = pages_[range.page];
+        page.vertexSpace.release(range.baseVertex, range.vertexCount);
+        page.indexSpace.release(range.firstIndex, range.indexCount);
+        --page.liveRanges;
+    }
+
+    GeometryArena::Stats GeometryArena::stats() const noexcept
+    {
+        Stats s{};
+        s.pages = static_cast<uint32_t>(pages_.size());
+        s.vmaAllocations = s.pages * 2;
+        for (const Page &p : pages_)
+        {
+            s.liveRanges += p.liveRanges;
+            s.freeBlocks += p.vertexSpace.blocks() + p.indexSpace.blocks();
+            s.vertexBytesUsed += uint64_t(p.vertexSpace.used()) * sizeof(Vertex);
+            s.vertexBytesCapacity += p.vertices.size();
+            s.indexBytesUsed += uint64_t(p.indexSpace.used()) * sizeof(uint32_t);
+            s.indexBytesCapacity += p.indices.size();
+        }
+        return s;
+    }
+
+} // namespace Vk::Gfx
@@ -1,20 +1,18 @@
 #include "rhi/vk/gfx/Mesh.h"
 #include "rhi/vk/Common.h" // VK_CHECK (if you use it elsewhere)
-#include "core/StringUtils.h"
+#include "rhi/vk/UploadContext.h"
 
 #include <algorithm>
 #include <limits>
+#include <string>
 
 namespace Vk::Gfx
 {
-    void Mesh::create(VmaAllocator allocator,
-                      VkDevice device,
-                      VkCommandPool cmdPool,
-                      VkQueue queue,
-                      const std::vector<Vertex> &vertices,
-                      const std::vector<uint32_t> &indices,
-                      const glm::mat4 &local,
-                      const std::string &meshPathOrName)
+    void Mesh::create(UploadContext &upload,
+                      GeometryArena &arena,
+                      std::span<const Vertex> vertices,
+                      std::span<const uint32_t> indices,
+                      const glm::mat4 &local)
     {
         // Validate indices against vertex count
         const uint32_t vtxCount = static_cast<uint32_t>(vertices.size());
@@ -53,67 +51,68 @@ namespace Vk::Gfx
         }
 
         indexCount_ = static_cast<uint32_t>(indices.size());
+        lods_.assign(1, Lod{0u, indexCount_, 0.0f});
 
-        std::string meshName = Core::Str::assetNameFromPath(meshPathOrName);
-        if (meshName.empty())
-            meshName = "Mesh";
+        // Suballocate from the arena (copies recorded into the upload batch)
+        range_ = arena.allocate(upload, vertices, indices);
+        arena_ = &arena;
+    }
 
-        // Create & upload VBO (DEVICE_LOCAL via transient staging)
-        const VkDeviceSize vboBytes = static_cast<VkDeviceSize>(sizeof(Vertex) * vertices.size());
-        if (vboBytes > 0)
+    void Mesh::setLods(std::span<const Lod> lods)
+    {
+        for (const Lod &l : lods)
         {
-            vbo_.createDeviceLocalWithData(
-                allocator, device, cmdPool, queue,
-                vertices.data(), vboBytes,
-                VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                (meshName + "_VB").c_str());
+            if (l.firstIndex > indexCount_ || l.indexCount > indexCount_ - l.firstIndex)
+            {
+                throw std::runtime_error(
+                    "Mesh::setLods: range [" + std::to_string(l.firstIndex) + ", +" +
+                    std::to_string(l.indexCount) + ") exceeds " + std::to_string(indexCount_) + " indices");
+            }
         }
+
+        if (lods.empty())
+            lods_.assign(1, Lod{0u, indexCount_, 0.0f});
         else
-        {
-            // Create an empty buffer so bind() is harmless (optional)
-            vbo_.create(allocator, device, 0,
-                        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                        VMA_MEMORY_USAGE_GPU_ONLY,
-                        0,
-                        (meshName + "_VB").c_str());
-        }
+            lods_.assign(lods.begin(), lods.end());
+    }
 
-        // Create & upload IBO (DEVICE_LOCAL via transient staging)
-        const VkDeviceSize iboBytes = static_cast<VkDeviceSize>(sizeof(uint32_t) * indices.size());
-        if (iboBytes > 0)
+    void Mesh::setMeshlets(std::span<const Meshlet> meshlets, std::span<const uint32_t> indices)
+    {
+        const uint32_t lod0Count = lods_.empty() ? 0u : lods_.front().indexCount;
+        if (indices.size() > lod0Count)
         {
-            ibo_.createDeviceLocalWithData(
-                allocator, device, cmdPool, queue,
-                indices.data(), iboBytes,
-                VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-                (meshName + "_IB").c_str());
+            throw std::runtime_error(
+                "Mesh::setMeshlets: " + std::to_string(indices.size()) + " indices exceed the LOD 0 range of " +
+                std::to_string(lod0Count));
         }
-        else
+        for (const Meshlet &m : meshlets)
         {
-            ibo_.create(allocator, device, 0,
-                        VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                        VMA_MEMORY_USAGE_GPU_ONLY,
-                        0,
-                        (meshName + "_IB").c_str());
+            if (m.firstIndex > indices.size() || m.indexCount > indices.size() - m.firstIndex)
+            {
+                throw std::runtime_error(
+                    "Mesh::setMeshlets: range [" + std::to_string(m.firstIndex) + ", +" +
+                    std::to_string(m.indexCount) + ") exceeds " + std::to_string(indices.size()) + " indices");
+            }
         }
-    }
 
-    void Mesh::bind(VkCommandBuffer cmd) const noexcept
-    {
-        if (vbo_.get() == VK_NULL_HANDLE || ibo_.get() == VK_NULL_HANDLE)
+        if (meshlets.empty())
+        {
+            meshlets_.clear();
+            meshletIndices_.clear();
             return;
-
-        VkBuffer vb = vbo_.get();
-        VkDeviceSize off = 0;
-        vkCmdBindVertexBuffers(cmd, 0, 1, &vb, &off);
-        vkCmdBindIndexBuffer(cmd, ibo_.get(), 0, VK_INDEX_TYPE_UINT32);
+        }
+        meshlets_.assign(meshlets.begin(), meshlets.end());
+        meshletIndices_.assign(indices.begin(), indices.end());
     }
 
-    void Mesh::draw(VkCommandBuffer cmd) const noexcept
+    void Mesh::draw(VkCommandBuffer cmd, uint32_t lod, uint32_t firstInstance, uint32_t instanceCount) const noexcept
     {
-        if (indexCount_ == 0)
+        if (lods_.empty())
+            return;
+        const Lod &l = lods_[std::min<std::size_t>(lod, lods_.size() - 1)];
+        if (l.indexCount == 0 || instanceCount == 0)
             return;
-        vkCmdDrawIndexed(cmd, indexCount_, 1, 0, 0, 0);
+        vkCmdDrawIndexed(cmd, l.indexCount, instanceCount, range_.firstIndex + l.firstIndex, baseVertex(), firstInstance);
     }
 
 } // namespace Vk::Gfx
@@ -0,0 +1,68 @@
+#include "rhi/vk/gfx/SamplerCache.h"
+#include "rhi/vk/Common.h"
+#include "rhi/vk/DebugUtils.h"
+
+#include <algorithm>
+#include <string>
+
+namespace Vk::Gfx
+{
+    void SamplerCache::init(VkDevice device, float maxAnisotropy)
+    {
+        destroy();
+
+        device_ = device;
+        maxAnisotropy_ = maxAnisotropy;
+    }
+
+    void SamplerCache::destroy() noexcept
+    {
+        if (device_)
+        {
+            for (const auto &[desc, sampler] : samplers_)
+                vkDestroySampler(device_, sampler, nullptr);
+        }
+        samplers_.clear();
+        requests_ = 0;
+        device_ = VK_NULL_HANDLE;
+    }
+
+    VkSampler SamplerCache::get(const SamplerDesc &desc)
+    {
+        ++requests_;
+
+        if (const auto it = samplers_.find(desc); it != samplers_.end())
+            return it->second;
+
+        // 1) Translate the key (anisotropy clamped to the device limit)
+        const float anisotropy = std::min(desc.maxAnisotropy, maxAnisotropy_);
+
+        VkSamplerCreateInfo si{VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
+        si.magFilter = desc.magFilter;
+        si.minFilter = desc.minFilter;
+        si.mipmapMode = desc.mipmapMode;
+        si.addressModeU = desc.addressU;
+        si.addressModeV = desc.addressV;
+        si.addressModeW = desc.addressW;
+        si.mipLodBias = desc.mipLodBias;
+        si.anisotropyEnable = anisotropy > 1.0f ? VK_TRUE : VK_FALSE;
+        si.maxAnisotropy = std::max(anisotropy, 1.0f);
+        si.compareEnable = desc.compareEnable ? VK_TRUE : VK_FALSE;
+        si.compareOp = desc.compareOp;
+        si.minLod = desc.minLod;
+        si.maxLod = desc.maxLod;
+        si.borderColor = desc.borderColor;
+        si.unnormalizedCoordinates = VK_FALSE;
+
+        // 2) Create and remember it
+        VkSampler sampler = VK_NULL_HANDLE;
+        VK_CHECK(vkCreateSampler(device_, &si, nullptr, &sampler));
+
+        const std::string name = "Sampler #" + std::to_string(samplers_.size());
+        nameSampler(device_, sampler, name.c_str());
+
+        samplers_.emplace(desc, sampler);
+        return sampler;
+    }
+
+} // namespace Vk::Gfx
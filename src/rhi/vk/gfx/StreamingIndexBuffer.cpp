@@ -0,0 +1,69 @@
+#include "rhi/vk/gfx/StreamingIndexBuffer.h"
+#include "rhi/vk/Common.h" // VK_CHECK
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace Vk::Gfx
+{
+    void StreamingIndexBuffer::create(VmaAllocator allocator, VkDevice device, uint32_t slotCount, std::size_t initialIndices)
+    {
+        destroy();
+
+        allocator_ = allocator;
+        device_ = device;
+        slots_.resize(slotCount);
+        for (uint32_t i = 0; i < slotCount; ++i)
+            createSlot(i, std::max<std::size_t>(initialIndices, 1));
+    }
+
+    void StreamingIndexBuffer::destroy() noexcept
+    {
+        slots_.clear();
+        allocator_ = VK_NULL_HANDLE;
+        device_ = VK_NULL_HANDLE;
+    }
+
+    void StreamingIndexBuffer::createSlot(uint32_t slot, std::size_t indexCount)
+    {
+        const std::string name = "StreamingIB_" + std::to_string(slot);
+        slots_[slot].create(allocator_, device_,
+                            static_cast<VkDeviceSize>(indexCount * sizeof(uint32_t)),
+                            VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                            VMA_MEMORY_USAGE_AUTO,
+                            VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                                VMA_ALLOCATION_CREATE_MAPPED_BIT,
+                            name.c_str());
+    }
+
+    uint32_t *StreamingIndexBuffer::reserve(uint32_t slot, std::size_t indexCount)
+    {
+        if (slot >= slots_.size())
+            throw std::runtime_error("StreamingIndexBuffer::reserve: slot " + std::to_string(slot) + " out of range");
+
+        // 1) Grow with headroom so a slowly rotating camera doesn't reallocate every frame
+        const std::size_t capacity = static_cast<std::size_t>(slots_[slot].size() / sizeof(uint32_t));
+        if (indexCount > capacity)
+            createSlot(slot, std::max(indexCount, capacity + capacity / 2));
+
+        return static_cast<uint32_t *>(slots_[slot].map());
+    }
+
+    void StreamingIndexBuffer::flush(uint32_t slot, std::size_t indexCount) const
+    {
+        if (slot >= slots_.size() || indexCount == 0)
+            return;
+        VK_CHECK(vmaFlushAllocation(allocator_, slots_[slot].allocation(), 0,
+                                    static_cast<VkDeviceSize>(indexCount * sizeof(uint32_t))));
+    }
+
+    VkDeviceSize StreamingIndexBuffer::capacityBytes() const noexcept
+    {
+        VkDeviceSize total = 0;
+        for (const Buffer &b : slots_)
+            total += b.size();
+        return total;
+    }
+
+} // namespace Vk::Gfx
@@ -2,6 +2,7 @@
 #include "rhi/vk/Common.h"
 #include "core/StringUtils.h" // Core::Str::assetNameFromPath
 #include "rhi/vk/DebugUtils.h"
+#include "rhi/vk/UploadContext.h"
 
 #include <algorithm>
 #include <cmath>
@@ -14,36 +15,6 @@
 
 namespace Vk::Gfx
 {
-    // ------------------------------------------------------------------------
-    // One-time command buffer utilities
-    // ------------------------------------------------------------------------
-    VkCommandBuffer Texture2D::beginOneTimeCommands(VkDevice device, VkCommandPool pool)
-    {
-        VkCommandBufferAllocateInfo ai{VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
-        ai.commandPool = pool;
-        ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        ai.commandBufferCount = 1;
-
-        VkCommandBuffer cmd{};
-        VK_CHECK(vkAllocateCommandBuffers(device, &ai, &cmd));
-
-        VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
-        bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        VK_CHECK(vkBeginCommandBuffer(cmd, &bi));
-        return cmd;
-    }
-
-    void Texture2D::endOneTimeCommands(VkDevice device, VkQueue queue, VkCommandPool pool, VkCommandBuffer cmd)
-    {
-        VK_CHECK(vkEndCommandBuffer(cmd));
-        VkSubmitInfo si{VK_STRUCTURE_TYPE_SUBMIT_INFO};
-        si.commandBufferCount = 1;
-        si.pCommandBuffers = &cmd;
-        VK_CHECK(vkQueueSubmit(queue, 1, &si, VK_NULL_HANDLE));
-        VK_CHECK(vkQueueWaitIdle(queue));
-        vkFreeCommandBuffers(device, pool, 1, &cmd);
-    }
-
     // ------------------------------------------------------------------------
     // Layout transition helper
     // ------------------------------------------------------------------------
@@ -110,7 +81,7 @@ namespace Vk::Gfx
     }
 
     // ------------------------------------------------------------------------
-    // Image view and sampler creation
+    // Image view creation
     // ------------------------------------------------------------------------
     void Texture2D::createImageView()
     {
@@ -118,6 +89,7 @@ namespace Vk::Gfx
         vi.image = image_;
         vi.viewType = VK_IMAGE_VIEW_TYPE_2D;
         vi.format = format_;
+        vi.components = swizzle_;
         vi.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         vi.subresourceRange.baseMipLevel = 0;
         vi.subresourceRange.levelCount = mipLevels_;
@@ -126,34 +98,11 @@ namespace Vk::Gfx
         VK_CHECK(vkCreateImageView(device_, &vi, nullptr, &imageView_));
     }
 
-    void Texture2D::createSampler()
-    {
-        VkSamplerCreateInfo si{VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
-        si.magFilter = VK_FILTER_LINEAR;
-        si.minFilter = VK_FILTER_LINEAR;
-        si.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
-        si.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        si.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        si.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        si.mipLodBias = 0.0f;
-        si.anisotropyEnable = VK_TRUE; // enable if GPU supports anisotropy
-        si.maxAnisotropy = 8.0f;
-        si.compareEnable = VK_FALSE;
-        si.minLod = 0.0f;
-        si.maxLod = float(mipLevels_);
-        si.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
-        si.unnormalizedCoordinates = VK_FALSE;
-
-        VK_CHECK(vkCreateSampler(device_, &si, nullptr, &sampler_));
-    }
-
     // ------------------------------------------------------------------------
     // GPU mipmap generation (linear blit between mip levels)
     // ------------------------------------------------------------------------
-    void Texture2D::generateMipmaps(VkCommandPool pool, VkQueue queue)
+    void Texture2D::generateMipmaps(VkCommandBuffer cmd)
     {
-        VkCommandBuffer cmd = beginOneTimeCommands(device_, pool);
-
         int32_t mipW = int32_t(width_);
         int32_t mipH = int32_t(height_);
 
@@ -191,18 +140,13 @@ namespace Vk::Gfx
         // all previous levels (currently SRC) -> SHADER_READ
         if (mipLevels_ > 1)
             transition(cmd, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, mipLevels_ - 1);
-
-        endOneTimeCommands(device_, queue, pool, cmd);
     }
 
     // ------------------------------------------------------------------------
     // Main creation API (VMA)
     // ------------------------------------------------------------------------
     void Texture2D::createFromRGBA8(
-        VmaAllocator allocator,
-        VkDevice device,
-        VkCommandPool cmdPool,
-        VkQueue graphicsQueue,
+        UploadContext &upload,
         const void *pixels,
         uint32_t w,
         uint32_t h,
@@ -210,14 +154,32 @@ namespace Vk::Gfx
         VkFormat format,
         const char *debugName)
     {
+        createFromPixels(upload, pixels, w, h, generateMips, format, debugName);
+    }
+
+    void Texture2D::createFromPixels(
+        UploadContext &upload,
+        const void *pixels,
+        uint32_t w,
+        uint32_t h,
+        bool generateMips,
+        VkFormat format,
+        const char *debugName,
+        VkComponentMapping swizzle)
+    {
+        uint32_t blockDim = 0, texelBytes = 0;
+        if (!blockInfo(format, blockDim, texelBytes) || blockDim != 1)
+            throw std::runtime_error("Texture2D::createFromPixels(): unsupported format");
+
         destroy(); // ensure previous resources are freed
 
-        allocator_ = allocator;
-        device_ = device;
+        allocator_ = upload.allocator();
+        device_ = upload.device();
         width_ = w;
         height_ = h;
         format_ = format;
         mipLevels_ = generateMips ? (1u + uint32_t(std::floor(std::log2(std::max(w, h))))) : 1u;
+        swizzle_ = swizzle;
 
         // 1) Allocate GPU image with VMA
         VkImageCreateInfo ii{VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
@@ -242,78 +204,146 @@ namespace Vk::Gfx
             nameImage(device_, image_, debugName);
         }
 
-        // 2) Create staging buffer (CPU → GPU)
-        VkDeviceSize byteSize = VkDeviceSize(size_t(w) * h * 4);
-        VkBuffer staging = VK_NULL_HANDLE;
-        VmaAllocation stagingAlloc = VK_NULL_HANDLE;
+        // 2) Whole image -> TRANSFER_DST, then stage mip 0 through the upload ring
+        transition(upload.commands(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, mipLevels_);
 
-        VkBufferCreateInfo bi{VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-        bi.size = byteSize;
-        bi.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        bi.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        // 3) Copy on the transfer queue (large images are split into row bands; may start a new batch),
+        //    then hand the image to the graphics family
+        upload.copyToImage(pixels, width_, height_, texelBytes, image_);
+        upload.transferOwnership(image_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels_);
+        VkCommandBuffer cmd = upload.graphicsCommands();
 
-        VmaAllocationCreateInfo sbAci{};
-        sbAci.usage = VMA_MEMORY_USAGE_CPU_TO_GPU;
+        // 4) Generate mipmaps (blits need the graphics queue) or transition to shader layout
+        if (mipLevels_ > 1)
+            generateMipmaps(cmd);
+        else
+            transition(cmd, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, 1);
 
-        VK_CHECK(vmaCreateBuffer(allocator_, &bi, &sbAci, &staging, &stagingAlloc, nullptr));
+        // 5) Create view (the sampler comes from setSampler())
+        createImageView();
         if (debugName && *debugName)
         {
-            std::string stgName = std::string(debugName) + " Staging";
-            vmaSetAllocationName(allocator_, stagingAlloc, stgName.c_str());
-            nameBuffer(device_, staging, stgName.c_str());
+            std::string n = std::string(debugName) + " View";
+            nameImageView(device_, imageView_, n.c_str());
         }
+    }
 
-        // Upload pixels
-        void *mapped = nullptr;
-        VK_CHECK(vmaMapMemory(allocator_, stagingAlloc, &mapped));
-        std::memcpy(mapped, pixels, size_t(byteSize));
-        vmaUnmapMemory(allocator_, stagingAlloc);
-
-        // 3) Copy staging buffer → GPU image
-        VkCommandBuffer cmd = beginOneTimeCommands(device_, cmdPool);
-        transition(cmd, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, mipLevels_);
+    void Texture2D::createFromLevels(
+        UploadContext &upload,
+        const void *data,
+        const UploadContext::ImageLevel *levels,
+        uint32_t levelCount,
+        uint32_t w,
+        uint32_t h,
+        VkFormat format,
+        const char *debugName,
+        VkComponentMapping swizzle)
+    {
+        uint32_t blockDim = 0, blockBytes = 0;
+        if (!blockInfo(format, blockDim, blockBytes))
+            throw std::runtime_error("Texture2D::createFromLevels(): unsupported format");
+        if (!data || !levels || levelCount == 0)
+            throw std::runtime_error("Texture2D::createFromLevels(): no levels");
 
-        VkBufferImageCopy copy{};
-        copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        copy.imageSubresource.layerCount = 1;
-        copy.imageExtent = {width_, height_, 1};
+        destroy(); // ensure previous resources are freed
 
-        vkCmdCopyBufferToImage(cmd, staging, image_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy);
-        endOneTimeCommands(device_, graphicsQueue, cmdPool, cmd);
+        allocator_ = upload.allocator();
+        device_ = upload.device();
+        width_ = w;
+        height_ = h;
+        format_ = format;
+        mipLevels_ = levelCount;
+        swizzle_ = swizzle;
 
-        // Free staging buffer
-        vmaDestroyBuffer(allocator_, staging, stagingAlloc);
+        // 1) Allocate GPU image with VMA (only ever written by copies)
+        VkImageCreateInfo ii{VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+        ii.imageType = VK_IMAGE_TYPE_2D;
+        ii.extent = {w, h, 1};
+        ii.mipLevels = mipLevels_;
+        ii.arrayLayers = 1;
+        ii.format = format_;
+        ii.tiling = VK_IMAGE_TILING_OPTIMAL;
+        ii.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        ii.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        ii.samples = VK_SAMPLE_COUNT_1_BIT;
+        ii.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-        // 4) Generate mipmaps or transition to shader layout
-        if (mipLevels_ > 1)
-            generateMipmaps(cmdPool, graphicsQueue);
-        else
+        VmaAllocationCreateInfo aci{};
+        aci.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+        VK_CHECK(vmaCreateImage(allocator_, &ii, &aci, &image_, &imageAlloc_, nullptr));
+        if (debugName && *debugName)
         {
-            VkCommandBuffer cmd2 = beginOneTimeCommands(device_, cmdPool);
-            transition(cmd2, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, 1);
-            endOneTimeCommands(device_, graphicsQueue, cmdPool, cmd2);
+            vmaSetAllocationName(allocator_, imageAlloc_, debugName);
+            nameImage(device_, image_, debugName);
         }
 
-        // 5) Create view and sampler
+        // 2) Every mip -> TRANSFER_DST, copy the whole chain, hand it to the graphics family
+        transition(upload.commands(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, mipLevels_);
+        upload.copyLevelsToImage(data, levels, levelCount, blockDim, blockBytes, image_);
+        upload.transferOwnership(image_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels_);
+
+        // 3) One transition for the whole chain (nothing to blit)
+        transition(upload.graphicsCommands(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, mipLevels_);
+
+        // 4) Create view (the sampler comes from setSampler())
         createImageView();
         if (debugName && *debugName)
         {
             std::string n = std::string(debugName) + " View";
             nameImageView(device_, imageView_, n.c_str());
         }
-        createSampler();
-        if (debugName && *debugName)
+    }
+
+    bool Texture2D::blockInfo(VkFormat format, uint32_t &blockDim, uint32_t &blockBytes)
+    {
+        switch (format)
         {
-            std::string n = std::string(debugName) + " Sampler";
-            nameSampler(device_, sampler_, n.c_str());
+        case VK_FORMAT_R8_UNORM:
+            blockDim = 1;
+            blockBytes = 1;
+            return true;
+        case VK_FORMAT_R8G8_UNORM:
+            blockDim = 1;
+            blockBytes = 2;
+            return true;
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            blockDim = 1;
+            blockBytes = 4;
+            return true;
+        case VK_FORMAT_BC4_UNORM_BLOCK:
+            blockDim = 4;
+            blockBytes = 8;
+            return true;
+        case VK_FORMAT_BC5_UNORM_BLOCK:
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+        case VK_FORMAT_BC7_SRGB_BLOCK:
+            blockDim = 4;
+            blockBytes = 16;
+            return true;
+        default:
+            return false;
         }
     }
 
+    uint64_t Texture2D::sizeBytes() const
+    {
+        uint32_t dim = 1, bytes = 4;
+        blockInfo(format_, dim, bytes); // unknown formats: counted as 4 bytes per texel
+
+        uint64_t total = 0;
+        for (uint32_t mip = 0; mip < mipLevels_; ++mip)
+        {
+            const uint64_t w = std::max(1u, width_ >> mip);
+            const uint64_t h = std::max(1u, height_ >> mip);
+            total += ((w + dim - 1) / dim) * ((h + dim - 1) / dim) * bytes;
+        }
+        return total;
+    }
+
     void Texture2D::loadFromFile(
-        VmaAllocator allocator,
-        VkDevice device,
-        VkCommandPool cmdPool,
-        VkQueue graphicsQueue,
+        UploadContext &upload,
         const std::string &path,
         bool genMips,
         VkFormat fmt)
@@ -328,7 +358,7 @@ namespace Vk::Gfx
 
         const std::string debugName = Core::Str::assetNameFromPath(path);
 
-        createFromRGBA8(allocator, device, cmdPool, graphicsQueue, data, uint32_t(w), uint32_t(h), genMips, fmt, debugName.c_str());
+        createFromRGBA8(upload, data, uint32_t(w), uint32_t(h), genMips, fmt, debugName.c_str());
         stbi_image_free(data);
 #endif
     }
@@ -338,11 +368,7 @@ namespace Vk::Gfx
         if (!device_)
             return;
 
-        if (sampler_)
-        {
-            vkDestroySampler(device_, sampler_, nullptr);
-            sampler_ = VK_NULL_HANDLE;
-        }
+        sampler_ = VK_NULL_HANDLE; // shared, not ours to destroy
         if (imageView_)
         {
             vkDestroyImageView(device_, imageView_, nullptr);
@@ -20,7 +20,10 @@
 #include "platform/WindowManager.h"
 #include "rhi/vk/DepthResources.h"
 #include "rhi/vk/CommandPool.h"
+#include "rhi/vk/CommandBuffers.h"
 #include "rhi/vk/memoryManager/VulkanAllocator.h"
+#include "render/DrawListBuilder.h"
+#include "render/materials/TextureCache.h"
 #include "rhi/vk/Common.h" // VK_CHECK
 
 #include <vector>
@@ -33,34 +36,6 @@
 namespace UI
 {
 
-    // Helper: allocate a short-lived command buffer and submit (used for font upload)
-    static VkCommandBuffer beginSingleTimeCommands(VkDevice device, VkCommandPool pool, VkQueue queue)
-    {
-        VkCommandBufferAllocateInfo allocInfo{VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
-        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        allocInfo.commandPool = pool;
-        allocInfo.commandBufferCount = 1;
-
-        VkCommandBuffer cmd;
-        VK_CHECK(vkAllocateCommandBuffers(device, &allocInfo, &cmd));
-
-        VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
-        bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        VK_CHECK(vkBeginCommandBuffer(cmd, &bi));
-        return cmd;
-    }
-
-    static void endSingleTimeCommands(VkDevice device, VkCommandPool pool, VkQueue queue, VkCommandBuffer cmd)
-    {
-        VK_CHECK(vkEndCommandBuffer(cmd));
-        VkSubmitInfo submit{VK_STRUCTURE_TYPE_SUBMIT_INFO};
-        submit.commandBufferCount = 1;
-        submit.pCommandBuffers = &cmd;
-        VK_CHECK(vkQueueSubmit(queue, 1, &submit, VK_NULL_HANDLE));
-        VK_CHECK(vkQueueWaitIdle(queue));
-        vkFreeCommandBuffers(device, pool, 1, &cmd);
-    }
-
     // Simple helper for ImGui Vulkan backend error checking
     static void check_vk_result(VkResult err)
     {
@@ -122,7 +97,6 @@ namespace UI
         device = context.device.getDevice();
         VkPhysicalDevice phys = context.physDevice.getDevice();
         VkQueue graphicsQueue = context.device.getGraphicsQueue();
-        VkCommandPool cmdPool = context.commandPool.get();
 
         // 1) Create ImGui context
         IMGUI_CHECKVERSION();
@@ -213,7 +187,7 @@ namespace UI
         return (f & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) ? "DEVICE_LOCAL" : "";
     }
 
-    void ImGuiLayer::drawVmaPanel(Vk::VulkanAllocator &allocator)
+    void ImGuiLayer::drawVmaPanel(Vk::VulkanAllocator &allocator, const Render::TextureCacheStats &textureCache)
     {
         if (!ImGui::Begin("Memory / VMA"))
         {
@@ -286,6 +260,96 @@ namespace UI
             ImGui::EndTable();
         }
 
+        // Texture / material sharing (MaterialSystem cache)
+        ImGui::SeparatorText("Texture cache");
+        const auto &tc = textureCache;
+        ImGui::Text("Textures: %u live, %.1f MB resident, %llu uploaded",
+                    tc.liveTextures, tc.bytesResident / (1024.0 * 1024.0),
+                    static_cast<unsigned long long>(tc.uploads));
+        ImGui::Text("Hits: %llu path + %llu content / %llu lookups",
+                    static_cast<unsigned long long>(tc.pathHits),
+                    static_cast<unsigned long long>(tc.contentHits),
+                    static_cast<unsigned long long>(tc.lookups));
+        ImGui::Text("Saved: %.1f MB", tc.bytesSaved / (1024.0 * 1024.0));
+        ImGui::Text("Materials: %llu shared / %llu requested",
+                    static_cast<unsigned long long>(tc.materialHits),
+                    static_cast<unsigned long long>(tc.materialLookups));
+        ImGui::Text("Cooked: %llu loaded, %llu cooked (%.0f ms)",
+                    static_cast<unsigned long long>(tc.cookedLoads),
+                    static_cast<unsigned long long>(tc.cooked), tc.cookMs);
+        ImGui::Text("Samplers: %u unique / %llu requests", tc.uniqueSamplers,
+                    static_cast<unsigned long long>(tc.samplerRequests));
+
+        ImGui::End();
+    }
+
+    void ImGuiLayer::drawRenderPanel(Render::DrawListBuilder &drawList, const Vk::RecordStats &recording)
+    {
+        if (!ImGui::Begin("Rendering"))
+        {
+            ImGui::End();
+            return;
+        }
+
+        // LOD selection controls
+        Render::LodSelectionSettings &lod = drawList.lodSettings();
+        ImGui::Checkbox("LOD selection", &lod.enabled);
+        ImGui::SliderFloat("Error threshold (px)", &lod.pixelThreshold, 0.25f, 8.0f, "%.2f");
+        ImGui::SliderFloat("Hysteresis", &lod.hysteresis, 0.0f, 0.9f, "%.2f");
+
+        ImGui::Separator();
+
+        // Triangle savings for the last built frame (not rebuilt while the GPU-driven path draws)
+        if (recording.indirectDraws > 0)
+            ImGui::TextDisabled("Draw list idle (GPU-driven culling): numbers of the last CPU frame");
+        const Render::DrawListStats &st = drawList.stats();
+        const double saved = st.trianglesFull > 0
+                                 ? 100.0 * double(st.trianglesFull - st.trianglesDrawn) / double(st.trianglesFull)
+                                 : 0.0;
+        ImGui::Text("Draw items: %u visible (%u at reduced LOD)", st.itemsVisible, st.itemsReduced);
+        ImGui::Text("Triangles: %llu / %llu (LOD 0)",
+                    static_cast<unsigned long long>(st.trianglesDrawn),
+                    static_cast<unsigned long long>(st.trianglesFull));
+        ImGui::Text("Saved by LOD: %.1f%%", saved);
+
+        ImGui::Separator();
+
+        // Draw order (state sort keys) and instancing of the resulting runs
+        Render::DrawOrderSettings &order = drawList.drawOrderSettings();
+        ImGui::Checkbox("Sort by state", &order.sortByState);
+        ImGui::SameLine();
+        ImGui::Checkbox("Instancing", &order.instancing);
+        ImGui::Text("Draw list: %u entries for %u items", st.draws, st.itemsVisible);
+        ImGui::Text("Sort CPU: %.3f ms", st.sortMs);
+
+        ImGui::Separator();
+
+        // Meshlet culling controls + last pass (runs per acquired image, so one frame behind this panel)
+        Render::ClusterCullSettings &cc = drawList.clusterSettings();
+        ImGui::Checkbox("Cluster culling", &cc.enabled);
+        ImGui::Checkbox("Frustum", &cc.frustum);
+        ImGui::SameLine();
+        ImGui::Checkbox("Normal cones", &cc.normalCones);
+
+        const Render::ClusterCullStats &cs = drawList.clusterStats();
+        ImGui::Text("Clustered items: %u", cs.itemsClustered);
+        ImGui::Text("Meshlets: %llu / %llu visible",
+                    static_cast<unsigned long long>(cs.clustersVisible),
+                    static_cast<unsigned long long>(cs.clustersTested));
+        ImGui::Text("Triangles submitted: %llu", static_cast<unsigned long long>(cs.trianglesSubmitted));
+        ImGui::Text("Cull CPU: %.3f ms", cs.cullMs);
+
+        ImGui::Separator();
+
+        // Scene command buffer of the last recorded image
+        if (recording.indirectDraws > 0)
+            ImGui::Text("Indirect draws: %u (visible objects counted on the GPU)", recording.indirectDraws);
+        else
+            ImGui::Text("Draws: %u (%u instances)", recording.draws, recording.instances);
+        ImGui::Text("Binds: %u vertex, %u index, %u descriptor",
+                    recording.vertexBufferBinds, recording.indexBufferBinds, recording.descriptorSetBinds);
+        ImGui::Text("Record CPU: %.3f ms", recording.cpuMs);
+
         ImGui::End();
     }
 